@@ -0,0 +1,25 @@
+/* Array object interface */
+
+/*
+123456789-123456789-123456789-123456789-123456789-123456789-123456789-12
+
+An array is a mutable sequence of numbers that all have the same C
+type, stored contiguously without boxing.  The type is given by a
+typecode: 'i' for C int (32 bits), 'l' for C long (64 bits on most
+machines) and 'd' for C double.  Items are converted to integer or
+float objects only when they are extracted.
+
+The arithmetic operators work elementwise on two arrays of the same
+type and length, or on an array and a number.  Integer arithmetic
+wraps around as in C.  Math module functions of one argument applied
+to an array return a 'd' array of results.
+*/
+
+extern typeobject Arraytype;
+
+#define is_arrayobject(op) ((op)->ob_type == &Arraytype)
+
+extern object *newarrayobject PROTO((int typecode, int size));
+extern object *listtoarray PROTO((int typecode, object *seq));
+extern int getarraysize PROTO((object *));
+extern object *arrayapply PROTO((object *, double (*)(double)));
@@ -1,5 +1,10 @@
 /* Bitset interface */
 
+/* A bitset is an array of bytes, so it can be written out (e.g. into
+   graminit.c) independent of the machine's byte order.  But newbitset
+   allocates whole words, so the operations below, which require bitsets
+   made by newbitset, can work a word at a time. */
+
 #define BYTE		char
 
 typedef BYTE *bitset;
@@ -10,6 +15,9 @@ void delbitset PROTO((bitset bs));
 int addbit PROTO((bitset bs, int ibit)); /* Returns 0 if already set */
 int samebitset PROTO((bitset bs1, bitset bs2, int nbits));
 void mergebitset PROTO((bitset bs1, bitset bs2, int nbits));
+unsigned long hashbitset PROTO((bitset bs, int nbits));
+int countbits PROTO((bitset bs, int nbits));
+int nextbit PROTO((bitset bs, int ibit, int nbits)); /* -1 if none */
 
 #define BITSPERBYTE	(8*sizeof(BYTE))
 #define NBYTES(nbits)	(((nbits) + BITSPERBYTE - 1) / BITSPERBYTE)
@@ -20,3 +28,7 @@ void mergebitset PROTO((bitset bs1, bitset bs2, int nbits));
 #define BYTE2BIT(ibyte)	((ibyte) * BITSPERBYTE)
 
 #define testbit(ss, ibit) (((ss)[BIT2BYTE(ibit)] & BIT2MASK(ibit)) != 0)
+
+#define WORD		unsigned long
+#define BITSPERWORD	(8*sizeof(WORD))
+#define NWORDS(nbits)	(((nbits) + BITSPERWORD - 1) / BITSPERWORD)
@@ -14,6 +14,7 @@ extern typeobject Classtype, Classmembertype, Classmethodtype;
 
 extern object *newclassobject PROTO((node *, object *, object *));
 extern object *newclassmemberobject PROTO((object *));
+extern object *classmembergetfunc PROTO((object *, char *));
 extern object *newclassmethodobject PROTO((object *, object *));
 
 extern object *classmethodgetfunc PROTO((object *));
@@ -0,0 +1,62 @@
+/* Definitions for compiled intermediate code */
+
+/*
+123456789-123456789-123456789-123456789-123456789-123456789-123456789-12
+
+A code object holds the instructions (see opcode.h), the list of
+constants and the list of names they use, and the exception table.
+
+The exception table lists the loops and try statements of the code.
+Nothing is done at run time when one of them is entered; when an
+exception (or a break or return) occurs, the interpreter looks up the
+instruction that raised it in the table.  The table is a string of
+XT_ENTRY-byte entries, each holding XT_NFIELDS numbers of four bytes,
+least significant byte first:
+
+	XT_TYPE		XT_LOOP, XT_EXCEPT or XT_FINALLY
+	XT_START	offset of the first instruction in the block
+	XT_END		offset of the first instruction after it
+	XT_HANDLER	where to jump to (the target of a break for loops)
+	XT_LEVEL	value stack level to pop to before jumping
+
+Entries are in order of the start of their blocks, so a block comes
+after the blocks that contain it.
+*/
+
+typedef struct {
+	OB_HEAD
+	stringobject *co_code;	/* instructions */
+	object *co_consts;	/* list of constants */
+	object *co_names;	/* list of strings */
+	stringobject *co_xtable; /* exception table */
+} codeobject;
+
+extern typeobject Codetype;
+
+#define is_codeobject(op) ((op)->ob_type == &Codetype)
+
+/* Magic word to reject compiled modules (.pyc files and frozen code)
+   written by another version.  Change it whenever the bytecode or the
+   marshal format changes. */
+
+#define MAGIC 0x999907L
+
+#define XT_LOOP		0
+#define XT_EXCEPT	1
+#define XT_FINALLY	2
+
+#define XT_TYPE		0
+#define XT_START	1
+#define XT_END		2
+#define XT_HANDLER	3
+#define XT_LEVEL	4
+#define XT_NFIELDS	5
+
+#define XT_ENTRY	(4*XT_NFIELDS)
+
+/* Field k of entry i of the table starting at unsigned char *p */
+#define XT_BYTE(p, i, k, j)	((long)(p)[XT_ENTRY*(i) + 4*(k) + (j)] << 8*(j))
+#define XT_GET(p, i, k)		(XT_BYTE(p, i, k, 0) | XT_BYTE(p, i, k, 1) | \
+				 XT_BYTE(p, i, k, 2) | XT_BYTE(p, i, k, 3))
+
+codeobject *compile PROTO((struct _node *));
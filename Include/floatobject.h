@@ -15,6 +15,7 @@ extern typeobject Floattype;
 
 extern object *newfloatobject PROTO((double));
 extern double getfloatvalue PROTO((object *));
+extern double parsefloat PROTO((char *, char **));
 
 /* Macro, trading safety for speed */
 #define GETFLOATVALUE(op) ((op)->ob_fval)
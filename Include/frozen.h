@@ -0,0 +1,23 @@
+/* Frozen modules interface */
+
+/*
+123456789-123456789-123456789-123456789-123456789-123456789-123456789-12
+
+A frozen module is a module whose compiled code is linked into the
+interpreter as a marshalled code object (see marshal.h), so importing
+it needs no file system access at all.  The code starts with MAGIC
+(see compile.h) in four bytes, least significant first, so a table
+written for another bytecode version is rejected at import.  The
+table is terminated by an entry whose name is NULL.  The default
+table (Python/frozen.c) is empty; the freeze program
+(Python/freezemain.c) writes a replacement for a chosen set of
+modules.
+*/
+
+struct frozen {
+	char *name;
+	unsigned char *code;
+	int size;
+};
+
+extern struct frozen frozen_modules[];
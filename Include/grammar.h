@@ -31,10 +31,10 @@ typedef struct _state {
 	int		 s_narcs;
 	arc		*s_arc;		/* Array of arcs */
 	
-	/* Optional accelerators */
+	/* Optional accelerators (see acceler.c) */
 	int		 s_lower;	/* Lowest label index */
 	int		 s_upper;	/* Highest label index */
-	int		*s_accel;	/* Accelerator */
+	const short	*s_accel;	/* Accelerator (read-only) */
 	int		 s_accept;	/* Nonzero for accepting state */
 } state;
 
@@ -51,12 +51,26 @@ typedef struct _dfa {
 
 /* A grammar */
 
+struct _parser_state; /* Defined in parser.h */
+
 typedef struct _grammar {
 	int		 g_ndfas;
 	dfa		*g_dfa;		/* Array of DFAs */
 	labellist	 g_ll;
 	int		 g_start;	/* Start symbol of the grammar */
 	int		 g_accel;	/* Set if accelerators present */
+	int		 g_compact;	/* Set to collapse single-child nodes */
+	
+	/* Optional tables for classifying tokens, written by pgen */
+	int		 g_kwsize;	/* Size of keyword hash table */
+	int		 g_kwmult;	/* Multiplier for keywordhash() */
+	short		*g_kwlabel;	/* Keyword label per hash slot, or -1 */
+	short		*g_toklabel;	/* Label per token type, or -1 */
+	
+	/* Optional direct-coded parser, written by pgen -d; it is passed
+	   the label of each token and does the work of addtoken() */
+	int		(*g_parse) FPROTO((struct _parser_state *,
+						int, int, char *));
 } grammar;
 
 /* FUNCTIONS */
@@ -71,6 +85,7 @@ char *typename PROTO((grammar *g, int lbl));
 int addlabel PROTO((labellist *ll, int type, char *str));
 int findlabel PROTO((labellist *ll, int type, char *str));
 char *labelrepr PROTO((label *lb));
+int keywordhash PROTO((char *s, int mult, int size));
 void translatelabels PROTO((grammar *g));
 
 void addfirstsets PROTO((grammar *g));
@@ -3,3 +3,11 @@
 object *new_module PROTO((char *name));
 object *import_module PROTO((struct _context *ctx, char *name));
 object *reload_module PROTO((struct _context *ctx, object *m));
+object *import_stats PROTO((void));
+void setlazyimport PROTO((int));
+void setstreamimport PROTO((int));
+void initbuiltin PROTO((char *, void (*) FPROTO((void))));
+int load_lazy_module PROTO((struct _context *ctx, object *m));
+
+/* Load m first if it is a lazily imported module; nonzero for errors */
+#define LOAD_LAZY(ctx, m) (is_moduleobject(m) && load_lazy_module(ctx, m))
@@ -12,6 +12,11 @@ count, but does decrement the reference count of the item it replaces,
 if not nil.  It does *decrement* the reference count if it is *not*
 inserted in the list.  Similarly, getlistitem does not increment the
 returned item's reference count.
+
+A list containing only integers, or only floats, keeps the bare numbers
+and creates the item objects when they are extracted.  Since getlistitem
+returns a borrowed reference, it first converts such a list to a list of
+object pointers; use the sq_item slot if that is not wanted.
 */
 
 extern typeobject Listtype;
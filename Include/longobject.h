@@ -0,0 +1,38 @@
+/* Long (arbitrary precision) integer object interface */
+
+/*
+123456789-123456789-123456789-123456789-123456789-123456789-123456789-12
+
+longobject represents an integer of unlimited size.  The absolute value
+is stored as ob_size digits in base 2**SHIFT, least significant digit
+first, without leading zero digits; ob_neg is set for negative numbers.
+Zero has ob_size == 0.
+
+Plain integer operations that overflow return a long integer instead,
+and long integer operations whose result fits in a C long return a
+plain integer, so normally the distinction is invisible.  The long
+operations accept plain integers as right operand.
+*/
+
+#define SHIFT	15
+#define BASE	((digit)1 << SHIFT)
+#define MASK	((int)(BASE - 1))
+
+typedef unsigned short digit;
+typedef unsigned long twodigits;	/* Must hold 2*SHIFT+1 bits */
+typedef long stwodigits;		/* Signed variant of twodigits */
+
+typedef struct {
+	OB_VARHEAD
+	int ob_neg;
+	digit ob_digit[1];
+} longobject;
+
+extern typeobject Longtype;
+
+#define is_longobject(op) ((op)->ob_type == &Longtype)
+
+extern object *newlongobject PROTO((long));
+extern longobject *alloclongobject PROTO((int));
+extern long getlongvalue PROTO((object *));
+extern object *long_scan PROTO((char *, char **, int));
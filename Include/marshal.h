@@ -0,0 +1,26 @@
+/* Interface for marshal.c */
+
+/*
+123456789-123456789-123456789-123456789-123456789-123456789-123456789-12
+
+Marshalling writes objects to a file in a compact binary format that
+can be read back by the same (or a compatible) interpreter.  Only
+None, integers, long integers, floats, strings, tuples, lists,
+dictionaries and code objects can be marshalled.  Longs are written
+as 4 bytes, least significant byte first, independent of the
+machine's byte order.
+
+wr_object returns 0, or -1 when the object (or part of it) could not
+be marshalled or the file write failed.
+
+rd_object and rds_object (which reads from a block of memory) return a
+new reference, or NULL with an error set when the data is malformed or
+truncated.
+*/
+
+void wr_long PROTO((long, FILE *));
+int wr_object PROTO((object *, FILE *));
+
+long rd_long PROTO((FILE *));
+object *rd_object PROTO((FILE *));
+object *rds_object PROTO((char *, int));
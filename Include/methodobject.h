@@ -6,6 +6,16 @@ extern typeobject Methodtype;
 
 typedef object *(*method) FPROTO((object *, object *));
 
+/* A method flagged METH_ARRAY takes its arguments as an array and a
+   count, instead of NULL, a single object or a tuple; the array may
+   point into the interpreter's value stack.  Such a method is stored
+   cast to method. */
+typedef object *(*arraymethod) FPROTO((object *, object **, int));
+
+#define METH_ARRAY	1
+
 extern object *newmethodobject PROTO((char *, method, object *));
+extern object *newflagmethodobject PROTO((char *, method, object *, int));
 extern method getmethod PROTO((object *));
 extern object *getself PROTO((object *));
+extern int getmethodflags PROTO((object *));
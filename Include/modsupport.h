@@ -3,7 +3,28 @@
 struct methodlist {
 	char *ml_name;
 	method ml_meth;
+	int ml_flags;	/* METH_ARRAY, or 0 (may be omitted) */
 };
 
 extern object *findmethod PROTO((struct methodlist *, object *, char *));
+extern object *getmethodfunc PROTO((object *, char *));
 extern object *initmodule PROTO((char *, struct methodlist *));
+
+/* Argument parsing.  The format has a letter per argument:
+	i	int *
+	l	long *	(an int, or a long that fits)
+	d	double *	(an int or a float)
+	s	object **	(a string; not INCREF'ed)
+	O	object **	(anything; not INCREF'ed)
+	(...)	a tuple whose items match the enclosed format
+   getargs parses an argument array, getobjargs the argument of an
+   ordinary method.  Both follow one rule, so f(a, b) and f((a, b))
+   are the same call: a lone tuple argument stands for its items.
+   (The interpreter unpacks it before calling a METH_ARRAY method;
+   getobjargs takes NULL as no arguments, a tuple as its items, and
+   anything else as one argument.)  To pass a tuple as the only
+   argument, wrap it: f((t,)).
+   They return 1 for success, or call err_set*() and return 0. */
+
+extern int getargs PROTO((object **, int, char *, ...));
+extern int getobjargs PROTO((object *, char *, ...));
@@ -8,3 +8,5 @@ extern object *newmoduleobject PROTO((char *));
 extern object *getmoduledict PROTO((object *));
 extern int setmoduledict PROTO((object *, object *));
 extern char *getmodulename PROTO((object *));
+extern int getmodulelazy PROTO((object *));
+extern int setmodulelazy PROTO((object *, int));
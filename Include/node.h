@@ -7,8 +7,13 @@ typedef struct _node {
 	struct _node	*n_child;
 } node;
 
-extern node *newnode PROTO((int type));
-extern node *addchild PROTO((node *n, int type, char *str));
+/* A tree owns the memory of all its nodes and of the strings stored in
+   them; it is allocated and freed as a whole, given the root node */
+extern node *newtree PROTO((int type));
+extern node *addchild PROTO((node *root, node *n, int type, char *str));
+extern char *treealloc PROTO((node *root, unsigned int size));
+extern void freetree PROTO((node *root));
+extern void collapsenode PROTO((node *root, node *n));
 
 /* Node access functions */
 #define NCH(n)		((n)->n_nchildren)
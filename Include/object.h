@@ -141,6 +141,11 @@ typedef struct _typeobject {
 	number_methods *tp_as_number;
 	sequence_methods *tp_as_sequence;
 	mapping_methods *tp_as_mapping;
+	
+	/* Method table (see modsupport.h), if tp_getattr does nothing
+	   but call findmethod with it */
+	
+	struct methodlist *tp_methods;
 } typeobject;
 
 extern typeobject Typetype; /* The type of type objects */
@@ -162,8 +167,9 @@ reference counts.  DECREF calls the object's deallocator function; for
 objects that don't contain references to other objects or heap memory
 this can be the standard function free().  Both macros can be used
 whereever a void expression is allowed.  The argument shouldn't be a
-NIL pointer.  The macro NEWREF(op) is used only to initialize reference
-counts to 1; it is defined here for convenience.
+NIL pointer; XINCREF(op) and XDECREF(op) accept one but can only be
+used as statements.  The macro NEWREF(op) is used only to initialize
+reference counts to 1; it is defined here for convenience.
 
 We assume that the reference count field can never overflow; this can
 be proven when the size of the field is the same as the pointer size
@@ -215,6 +221,11 @@ extern long ref_total;
 		DELREF(op)
 #endif
 
+/* Macros to use in case the object pointer may be NULL: */
+
+#define XINCREF(op) if ((op) == NULL) ; else INCREF(op)
+#define XDECREF(op) if ((op) == NULL) ; else DECREF(op)
+
 
 /* Definition of NULL, so you don't have to include <stdio.h> */
 
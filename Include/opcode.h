@@ -1,5 +1,22 @@
 /* Instruction opcodes for compiled code */
 
+/* Every instruction is two bytes: the opcode, then an argument byte
+   (zero for opcodes below HAVE_ARGUMENT).  An argument that doesn't
+   fit in a byte is preceded by EXTENDED_ARG instructions whose
+   arguments are its higher bytes, most significant first.  Jump
+   targets are byte offsets from the beginning of the code.
+
+   INSTR(p) makes one word of the instruction at p (an unsigned
+   char *) with the same layout on any byte order; the code string is
+   aligned, so compilers can usually fetch both bytes in one load.
+
+   Loops and try statements have no instructions of their own; they
+   are described by the exception table of the code (see compile.h). */
+
+#define INSTR(p)	((p)[0] | (p)[1] << 8)
+#define OPCODE(w)	((w) & 0xff)
+#define OPARG(w)	((w) >> 8)
+
 #define DUP_TOP		0
 #define POP_TOP		1
 #define ROT_TWO		2
@@ -41,7 +58,6 @@
 #define REQUIRE_ARGS	84
 #define REFUSE_ARGS	85
 #define BUILD_FUNCTION	86
-#define POP_BLOCK	87
 #define END_FINALLY	88
 
 #define HAVE_ARGUMENT	90	/* Opcodes from here have an argument: */
@@ -64,15 +80,17 @@
 #define IMPORT_NAME	107	/* Index in name list */
 #define IMPORT_FROM	108	/* Index in name list */
 
-#define JUMP_FORWARD	110	/* Number of bytes to skip */
+#define JUMP_FORWARD	110	/* Target byte offset from beginning of code */
 #define JUMP_IF_FALSE	111	/* "" */
 #define JUMP_IF_TRUE	112	/* "" */
-#define JUMP_ABSOLUTE	113	/* Target byte offset from beginning of code */
-#define FOR_LOOP	114	/* Number of bytes to skip */
+#define JUMP_ABSOLUTE	113	/* "" */
+#define FOR_LOOP	114	/* "" */
+
+#define EXTENDED_ARG	130	/* Higher bits of the next argument */
 
-#define SETUP_LOOP	120	/* Target address (absolute) */
-#define SETUP_EXCEPT	121	/* "" */
-#define SETUP_FINALLY	122	/* "" */
+#define LOAD_METHOD	140	/* Index in name list */
+#define CALL_METHOD	141	/* Number of arguments */
+#define CALL_FUNCTION	142	/* Number of arguments */
 
 /* Comparison operator codes (argument to COMPARE_OP) */
 enum cmp_op {LT, LE, EQ, NE, GT, GE, IN, NOT_IN, IS, IS_NOT, EXC_MATCH, BAD};
@@ -7,3 +7,9 @@ extern int parsetok PROTO((struct tok_state *, grammar *, int start,
 extern int parsestring PROTO((char *, grammar *, int start, node **n_ret));
 extern int parsefile PROTO((FILE *, grammar *, int start,
 					char *ps1, char *ps2, node **n_ret));
+
+struct stmtfile; /* Opaque; see parsetok.c */
+extern struct stmtfile *openstmts PROTO((FILE *));
+extern int parsestmt PROTO((struct stmtfile *, grammar *, int start,
+							node **n_ret));
+extern void closestmts PROTO((struct stmtfile *));
@@ -12,6 +12,9 @@ count, but does decrement the reference count of the item it replaces,
 if not nil.  It does *decrement* the reference count if it is *not*
 inserted in the tuple.  Similarly, gettupleitem does not increment the
 returned item's reference count.
+
+gettupleitems returns a pointer to the array of items, for passing
+them to a method that takes an argument array (see methodobject.h).
 */
 
 extern typeobject Tupletype;
@@ -21,4 +24,5 @@ extern typeobject Tupletype;
 extern object *newtupleobject PROTO((int size));
 extern int gettuplesize PROTO((object *));
 extern object *gettupleitem PROTO((object *, int));
+extern object **gettupleitems PROTO((object *));
 extern int settupleitem PROTO((object *, int, object *));
@@ -0,0 +1,88 @@
+/* Array module -- constructors for typed numeric arrays */
+
+#include <stdio.h>
+
+#include "PROTO.h"
+#include "object.h"
+#include "intobject.h"
+#include "stringobject.h"
+#include "tupleobject.h"
+#include "arrayobject.h"
+#include "methodobject.h"
+#include "moduleobject.h"
+#include "objimpl.h"
+#include "import.h"
+#include "modsupport.h"
+#include "errors.h"
+
+static int
+gettypecode(v, p_typecode)
+	object *v;
+	int *p_typecode;
+{
+	object *s;
+	if (!getstrarg(v, &s))
+		return 0;
+	if (getstringsize(s) != 1) {
+		err_setstr(TypeError, "array typecode must be a single character");
+		return 0;
+	}
+	*p_typecode = getstringvalue(s)[0];
+	return 1;
+}
+
+/* array(typecode) or array(typecode, list_or_tuple) */
+
+static object *
+array_array(self, args)
+	object *self;
+	object *args;
+{
+	int typecode;
+	if (args != NULL && is_tupleobject(args)) {
+		if (gettuplesize(args) != 2) {
+			err_badarg();
+			return NULL;
+		}
+		if (!gettypecode(gettupleitem(args, 0), &typecode))
+			return NULL;
+		return listtoarray(typecode, gettupleitem(args, 1));
+	}
+	if (!gettypecode(args, &typecode))
+		return NULL;
+	return newarrayobject(typecode, 0);
+}
+
+/* zeros(typecode, n) */
+
+static object *
+array_zeros(self, args)
+	object *self;
+	object *args;
+{
+	object *s;
+	int n;
+	if (!getstrintarg(args, &s, &n))
+		return NULL;
+	if (getstringsize(s) != 1) {
+		err_setstr(TypeError, "array typecode must be a single character");
+		return NULL;
+	}
+	if (n < 0) {
+		err_setstr(RuntimeError, "negative array size");
+		return NULL;
+	}
+	return newarrayobject(getstringvalue(s)[0], n);
+}
+
+static struct methodlist array_methods[] = {
+	{"array",	array_array},
+	{"zeros",	array_zeros},
+	{NULL,		NULL}		/* sentinel */
+};
+
+void
+initarray()
+{
+	initmodule("array", array_methods);
+}
@@ -8,6 +8,7 @@
 #include "intobject.h"
 #include "tupleobject.h"
 #include "floatobject.h"
+#include "arrayobject.h"
 #include "dictobject.h"
 #include "methodobject.h"
 #include "moduleobject.h"
@@ -15,42 +16,16 @@
 #include "import.h"
 #include "modsupport.h"
 
-static int
-getdoublearg(args, px)
-	register object *args;
-	double *px;
-{
-	if (args == NULL)
-		return err_badarg();
-	if (is_floatobject(args)) {
-		*px = getfloatvalue(args);
-		return 1;
-	}
-	if (is_intobject(args)) {
-		*px = getintvalue(args);
-		return 1;
-	}
-	return err_badarg();
-}
-
-static int
-get2doublearg(args, px, py)
-	register object *args;
-	double *px, *py;
-{
-	if (args == NULL || !is_tupleobject(args) || gettuplesize(args) != 2)
-		return err_badarg();
-	return getdoublearg(gettupleitem(args, 0), px) &&
-		getdoublearg(gettupleitem(args, 1), py);
-}
-
 static object *
-math_1(args, func)
-	object *args;
+math_1(argv, argc, func)
+	object **argv;
+	int argc;
 	double (*func) FPROTO((double));
 {
 	double x;
-	if (!getdoublearg(args, &x))
+	if (argc == 1 && is_arrayobject(argv[0]))
+		return arrayapply(argv[0], func);
+	if (!getargs(argv, argc, "d", &x))
 		return NULL;
 	errno = 0;
 	x = (*func)(x);
@@ -61,12 +36,13 @@ math_1(args, func)
 }
 
 static object *
-math_2(args, func)
-	object *args;
+math_2(argv, argc, func)
+	object **argv;
+	int argc;
 	double (*func) FPROTO((double, double));
 {
 	double x, y;
-	if (!get2doublearg(args, &x, &y))
+	if (!getargs(argv, argc, "dd", &x, &y))
 		return NULL;
 	errno = 0;
 	x = (*func)(x, y);
@@ -77,13 +53,15 @@ math_2(args, func)
 }
 
 #define FUNC1(stubname, func) \
-	static object * stubname(self, args) object *self, *args; { \
-		return math_1(args, func); \
+	static object * stubname(self, argv, argc) \
+		object *self, **argv; int argc; { \
+		return math_1(argv, argc, func); \
 	}
 
 #define FUNC2(stubname, func) \
-	static object * stubname(self, args) object *self, *args; { \
-		return math_2(args, func); \
+	static object * stubname(self, argv, argc) \
+		object *self, **argv; int argc; { \
+		return math_2(argv, argc, func); \
 	}
 
 FUNC1(math_acos, acos)
@@ -117,32 +95,32 @@ double	modf(double x, double *i);
 #endif
 
 static struct methodlist math_methods[] = {
-	{"acos", math_acos},
-	{"asin", math_asin},
-	{"atan", math_atan},
-	{"atan2", math_atan2},
-	{"ceil", math_ceil},
-	{"cos", math_cos},
-	{"cosh", math_cosh},
-	{"exp", math_exp},
-	{"fabs", math_fabs},
-	{"floor", math_floor},
+	{"acos", (method)math_acos, METH_ARRAY},
+	{"asin", (method)math_asin, METH_ARRAY},
+	{"atan", (method)math_atan, METH_ARRAY},
+	{"atan2", (method)math_atan2, METH_ARRAY},
+	{"ceil", (method)math_ceil, METH_ARRAY},
+	{"cos", (method)math_cos, METH_ARRAY},
+	{"cosh", (method)math_cosh, METH_ARRAY},
+	{"exp", (method)math_exp, METH_ARRAY},
+	{"fabs", (method)math_fabs, METH_ARRAY},
+	{"floor", (method)math_floor, METH_ARRAY},
 #if 0
-	{"fmod", math_fmod},
-	{"frexp", math_freqp},
-	{"ldexp", math_ldexp},
+	{"fmod", (method)math_fmod, METH_ARRAY},
+	{"frexp", (method)math_freqp, METH_ARRAY},
+	{"ldexp", (method)math_ldexp, METH_ARRAY},
 #endif
-	{"log", math_log},
-	{"log10", math_log10},
+	{"log", (method)math_log, METH_ARRAY},
+	{"log10", (method)math_log10, METH_ARRAY},
 #if 0
-	{"modf", math_modf},
+	{"modf", (method)math_modf, METH_ARRAY},
 #endif
-	{"pow", math_pow},
-	{"sin", math_sin},
-	{"sinh", math_sinh},
-	{"sqrt", math_sqrt},
-	{"tan", math_tan},
-	{"tanh", math_tanh},
+	{"pow", (method)math_pow, METH_ARRAY},
+	{"sin", (method)math_sin, METH_ARRAY},
+	{"sinh", (method)math_sinh, METH_ARRAY},
+	{"sqrt", (method)math_sqrt, METH_ARRAY},
+	{"tan", (method)math_tan, METH_ARRAY},
+	{"tanh", (method)math_tanh, METH_ARRAY},
 	{NULL,		NULL}		/* sentinel */
 };
 
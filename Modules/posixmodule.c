@@ -82,12 +82,13 @@ posix_error()
 /* POSIX generic methods */
 
 static object *
-posix_1str(args, func)
-	object *args;
+posix_1str(argv, argc, func)
+	object **argv;
+	int argc;
 	int (*func) FPROTO((const char *));
 {
 	object *path1;
-	if (!getstrarg(args, &path1))
+	if (!getargs(argv, argc, "s", &path1))
 		return NULL;
 	if ((*func)(getstringvalue(path1)) < 0)
 		return posix_error();
@@ -96,12 +97,13 @@ posix_1str(args, func)
 }
 
 static object *
-posix_2str(args, func)
-	object *args;
+posix_2str(argv, argc, func)
+	object **argv;
+	int argc;
 	int (*func) FPROTO((const char *, const char *));
 {
 	object *path1, *path2;
-	if (!getstrstrarg(args, &path1, &path2))
+	if (!getargs(argv, argc, "ss", &path1, &path2))
 		return NULL;
 	if ((*func)(getstringvalue(path1), getstringvalue(path2)) < 0)
 		return posix_error();
@@ -110,13 +112,14 @@ posix_2str(args, func)
 }
 
 static object *
-posix_strint(args, func)
-	object *args;
+posix_strint(argv, argc, func)
+	object **argv;
+	int argc;
 	int (*func) FPROTO((const char *, int));
 {
 	object *path1;
 	int i;
-	if (!getstrintarg(args, &path1, &i))
+	if (!getargs(argv, argc, "si", &path1, &i))
 		return NULL;
 	if ((*func)(getstringvalue(path1), i) < 0)
 		return posix_error();
@@ -125,15 +128,16 @@ posix_strint(args, func)
 }
 
 static object *
-posix_do_stat(self, args, statfunc)
+posix_do_stat(self, argv, argc, statfunc)
 	object *self;
-	object *args;
+	object **argv;
+	int argc;
 	int (*statfunc) FPROTO((const char *, struct stat *));
 {
 	struct stat st;
 	object *path;
 	object *v;
-	if (!getstrarg(args, &path))
+	if (!getargs(argv, argc, "s", &path))
 		return NULL;
 	if ((*statfunc)(getstringvalue(path), &st) != 0)
 		return posix_error();
@@ -164,31 +168,34 @@ posix_do_stat(self, args, statfunc)
 /* POSIX methods */
 
 static object *
-posix_chdir(self, args)
+posix_chdir(self, argv, argc)
 	object *self;
-	object *args;
+	object **argv;
+	int argc;
 {
 	extern int chdir PROTO((const char *));
-	return posix_1str(args, chdir);
+	return posix_1str(argv, argc, chdir);
 }
 
 static object *
-posix_chmod(self, args)
+posix_chmod(self, argv, argc)
 	object *self;
-	object *args;
+	object **argv;
+	int argc;
 {
 	extern int chmod PROTO((const char *, mode_t));
-	return posix_strint(args, chmod);
+	return posix_strint(argv, argc, chmod);
 }
 
 static object *
-posix_getcwd(self, args)
+posix_getcwd(self, argv, argc)
 	object *self;
-	object *args;
+	object **argv;
+	int argc;
 {
 	char buf[1026];
 	extern char *getcwd PROTO((char *, int));
-	if (!getnoarg(args))
+	if (!getargs(argv, argc, ""))
 		return NULL;
 	if (getcwd(buf, sizeof buf) == NULL)
 		return posix_error();
@@ -196,23 +203,25 @@ posix_getcwd(self, args)
 }
 
 static object *
-posix_link(self, args)
+posix_link(self, argv, argc)
 	object *self;
-	object *args;
+	object **argv;
+	int argc;
 {
 	extern int link PROTO((const char *, const char *));
-	return posix_2str(args, link);
+	return posix_2str(argv, argc, link);
 }
 
 static object *
-posix_listdir(self, args)
+posix_listdir(self, argv, argc)
 	object *self;
-	object *args;
+	object **argv;
+	int argc;
 {
 	object *name, *d, *v;
 	DIR *dirp;
 	struct direct *ep;
-	if (!getstrarg(args, &name))
+	if (!getargs(argv, argc, "s", &name))
 		return NULL;
 	if ((dirp = opendir(getstringvalue(name))) == NULL)
 		return posix_error();
@@ -240,61 +249,67 @@ posix_listdir(self, args)
 }
 
 static object *
-posix_mkdir(self, args)
+posix_mkdir(self, argv, argc)
 	object *self;
-	object *args;
+	object **argv;
+	int argc;
 {
 	extern int mkdir PROTO((const char *, mode_t));
-	return posix_strint(args, mkdir);
+	return posix_strint(argv, argc, mkdir);
 }
 
 static object *
-posix_rename(self, args)
+posix_rename(self, argv, argc)
 	object *self;
-	object *args;
+	object **argv;
+	int argc;
 {
 	extern int rename PROTO((const char *, const char *));
-	return posix_2str(args, rename);
+	return posix_2str(argv, argc, rename);
 }
 
 static object *
-posix_rmdir(self, args)
+posix_rmdir(self, argv, argc)
 	object *self;
-	object *args;
+	object **argv;
+	int argc;
 {
 	extern int rmdir PROTO((const char *));
-	return posix_1str(args, rmdir);
+	return posix_1str(argv, argc, rmdir);
 }
 
 static object *
-posix_stat(self, args)
+posix_stat(self, argv, argc)
 	object *self;
-	object *args;
+	object **argv;
+	int argc;
 {
 	extern int stat PROTO((const char *, struct stat *));
-	return posix_do_stat(self, args, stat);
+	return posix_do_stat(self, argv, argc, stat);
 }
 
 static object *
-posix_system(self, args)
+posix_system(self, argv, argc)
 	object *self;
-	object *args;
+	object **argv;
+	int argc;
 {
 	object *command;
 	int sts;
-	if (!getstrarg(args, &command))
+	if (!getargs(argv, argc, "s", &command))
 		return NULL;
 	sts = system(getstringvalue(command));
 	return newintobject((long)sts);
 }
 
 static object *
-posix_umask(self, args)
+posix_umask(self, argv, argc)
 	object *self;
-	object *args;
+	object **argv;
+	int argc;
 {
 	int i;
-	if (!getintarg(args, &i))
+	if (!getargs(argv, argc, "i", &i))
 		return NULL;
 	i = umask(i);
 	if (i < 0)
@@ -303,28 +318,25 @@ posix_umask(self, args)
 }
 
 static object *
-posix_unlink(self, args)
+posix_unlink(self, argv, argc)
 	object *self;
-	object *args;
+	object **argv;
+	int argc;
 {
 	extern int unlink PROTO((const char *));
-	return posix_1str(args, unlink);
+	return posix_1str(argv, argc, unlink);
 }
 
 static object *
-posix_utimes(self, args)
+posix_utimes(self, argv, argc)
 	object *self;
-	object *args;
+	object **argv;
+	int argc;
 {
 	object *path;
 	struct timeval tv[2];
-	if (args == NULL || !is_tupleobject(args) || gettuplesize(args) != 2) {
-		err_badarg();
-		return NULL;
-	}
-	if (!getstrarg(gettupleitem(args, 0), &path) ||
-				!getlonglongargs(gettupleitem(args, 1),
-					&tv[0].tv_sec, &tv[1].tv_sec))
+	if (!getargs(argv, argc, "s(ll)",
+				&path, &tv[0].tv_sec, &tv[1].tv_sec))
 		return NULL;
 	tv[0].tv_usec = tv[1].tv_usec = 0;
 	if (utimes(getstringvalue(path), tv) < 0)
@@ -356,23 +368,25 @@ getcwd(buf, size)
 #ifndef NO_LSTAT
 
 static object *
-posix_lstat(self, args)
+posix_lstat(self, argv, argc)
 	object *self;
-	object *args;
+	object **argv;
+	int argc;
 {
 	extern int lstat PROTO((const char *, struct stat *));
-	return posix_do_stat(self, args, lstat);
+	return posix_do_stat(self, argv, argc, lstat);
 }
 
 static object *
-posix_readlink(self, args)
+posix_readlink(self, argv, argc)
 	object *self;
-	object *args;
+	object **argv;
+	int argc;
 {
 	char buf[1024]; /* XXX Should use MAXPATHLEN */
 	object *path;
 	int n;
-	if (!getstrarg(args, &path))
+	if (!getargs(argv, argc, "s", &path))
 		return NULL;
 	n = readlink(getstringvalue(path), buf, sizeof buf);
 	if (n < 0)
@@ -381,35 +395,36 @@ posix_readlink(self, args)
 }
 
 static object *
-posix_symlink(self, args)
+posix_symlink(self, argv, argc)
 	object *self;
-	object *args;
+	object **argv;
+	int argc;
 {
 	extern int symlink PROTO((const char *, const char *));
-	return posix_2str(args, symlink);
+	return posix_2str(argv, argc, symlink);
 }
 
 #endif /* NO_LSTAT */
 
 
 static struct methodlist posix_methods[] = {
-	{"chdir",	posix_chdir},
-	{"chmod",	posix_chmod},
-	{"getcwd",	posix_getcwd},
-	{"link",	posix_link},
-	{"listdir",	posix_listdir},
-	{"mkdir",	posix_mkdir},
-	{"rename",	posix_rename},
-	{"rmdir",	posix_rmdir},
-	{"stat",	posix_stat},
-	{"system",	posix_system},
-	{"umask",	posix_umask},
-	{"unlink",	posix_unlink},
-	{"utimes",	posix_utimes},
+	{"chdir",	(method)posix_chdir, METH_ARRAY},
+	{"chmod",	(method)posix_chmod, METH_ARRAY},
+	{"getcwd",	(method)posix_getcwd, METH_ARRAY},
+	{"link",	(method)posix_link, METH_ARRAY},
+	{"listdir",	(method)posix_listdir, METH_ARRAY},
+	{"mkdir",	(method)posix_mkdir, METH_ARRAY},
+	{"rename",	(method)posix_rename, METH_ARRAY},
+	{"rmdir",	(method)posix_rmdir, METH_ARRAY},
+	{"stat",	(method)posix_stat, METH_ARRAY},
+	{"system",	(method)posix_system, METH_ARRAY},
+	{"umask",	(method)posix_umask, METH_ARRAY},
+	{"unlink",	(method)posix_unlink, METH_ARRAY},
+	{"utimes",	(method)posix_utimes, METH_ARRAY},
 #ifndef NO_LSTAT
-	{"lstat",	posix_lstat},
-	{"readlink",	posix_readlink},
-	{"symlink",	posix_symlink},
+	{"lstat",	(method)posix_lstat, METH_ARRAY},
+	{"readlink",	(method)posix_readlink, METH_ARRAY},
+	{"symlink",	(method)posix_symlink, METH_ARRAY},
 #endif
 	{NULL,		NULL}		 /* Sentinel */
 };
@@ -484,6 +484,10 @@ static typeobject Drawingtype = {
 	0,			/*tp_setattr*/
 	0,			/*tp_compare*/
 	0,			/*tp_repr*/
+	0,			/*tp_as_number*/
+	0,			/*tp_as_sequence*/
+	0,			/*tp_as_mapping*/
+	drawing_methods,	/*tp_methods*/
 };
 
 
@@ -0,0 +1,899 @@
+/* Array object implementation */
+
+#include <stdio.h>
+#include <errno.h>
+#include "string.h"
+
+#include "PROTO.h"
+#include "object.h"
+#include "intobject.h"
+#include "floatobject.h"
+#include "stringobject.h"
+#include "tupleobject.h"
+#include "listobject.h"
+#include "methodobject.h"
+#include "arrayobject.h"
+#include "objimpl.h"
+#include "modsupport.h"
+#include "errors.h"
+
+typedef struct {
+	OB_VARHEAD
+	int ob_typecode;	/* 'i', 'l' or 'd' */
+	char *ob_item;		/* ob_size items of the given type */
+} arrayobject;
+
+/* The inner loops below are written so that the compiler sees plain
+   loops over contiguous C arrays, which it can unroll or vectorize. */
+
+#define IPTR(a) ((int *)(a)->ob_item)
+#define LPTR(a) ((long *)(a)->ob_item)
+#define DPTR(a) ((double *)(a)->ob_item)
+
+static int
+itemsize(typecode)
+	int typecode;
+{
+	switch (typecode) {
+	case 'i':	return sizeof(int);
+	case 'l':	return sizeof(long);
+	case 'd':	return sizeof(double);
+	}
+	return 0;
+}
+
+object *
+newarrayobject(typecode, size)
+	int typecode;
+	int size;
+{
+	arrayobject *op;
+	int n = itemsize(typecode);
+	if (n == 0) {
+		err_setstr(TypeError, "array typecode must be 'i', 'l' or 'd'");
+		return NULL;
+	}
+	if (size < 0) {
+		err_badcall();
+		return NULL;
+	}
+	if (size > (int)(~(unsigned int)0 >> 1) / n)
+		return err_nomem();
+	op = NEWOBJ(arrayobject, &Arraytype);
+	if (op == NULL)
+		return NULL;
+	/* Always allocate something so ob_item is never NULL */
+	op->ob_item = malloc(size > 0 ? size * n : 1);
+	if (op->ob_item == NULL) {
+		DEL(op);
+		return err_nomem();
+	}
+	memset(op->ob_item, 0, size * n);
+	op->ob_size = size;
+	op->ob_typecode = typecode;
+	return (object *) op;
+}
+
+int
+getarraysize(op)
+	object *op;
+{
+	if (!is_arrayobject(op)) {
+		err_badcall();
+		return -1;
+	}
+	return ((arrayobject *)op) -> ob_size;
+}
+
+static object *
+getarrayitem(a, i)
+	arrayobject *a;
+	int i;
+{
+	switch (a->ob_typecode) {
+	case 'i':	return newintobject((long) IPTR(a)[i]);
+	case 'l':	return newintobject(LPTR(a)[i]);
+	default:	return newfloatobject(DPTR(a)[i]);
+	}
+}
+
+/* Convert a number to the C type of an array */
+
+static int
+getlongnum(typecode, v, p_x)
+	int typecode;
+	object *v;
+	long *p_x;
+{
+	if (!is_intobject(v)) {
+		err_setstr(TypeError, "integer array item must be int");
+		return -1;
+	}
+	*p_x = getintvalue(v);
+	if (typecode == 'i' && (int)*p_x != *p_x) {
+		err_setstr(OverflowError, "value too large for 'i' array");
+		return -1;
+	}
+	return 0;
+}
+
+static int
+getdoublenum(v, p_x)
+	object *v;
+	double *p_x;
+{
+	if (is_floatobject(v))
+		*p_x = getfloatvalue(v);
+	else if (is_intobject(v))
+		*p_x = getintvalue(v);
+	else {
+		err_setstr(TypeError, "float array item must be float or int");
+		return -1;
+	}
+	return 0;
+}
+
+static int
+setarrayitem(a, i, v)
+	arrayobject *a;
+	int i;
+	object *v;
+{
+	long x;
+	if (a->ob_typecode == 'd')
+		return getdoublenum(v, &DPTR(a)[i]);
+	if (getlongnum(a->ob_typecode, v, &x) < 0)
+		return -1;
+	if (a->ob_typecode == 'i')
+		IPTR(a)[i] = x;
+	else
+		LPTR(a)[i] = x;
+	return 0;
+}
+
+object *
+listtoarray(typecode, seq)
+	int typecode;
+	object *seq;
+{
+	int i, n;
+	object *a, *v;
+	object *(*getitem) FPROTO((object *, int));
+	if (!is_listobject(seq) && !is_tupleobject(seq)) {
+		err_setstr(TypeError, "array initializer must be list or tuple");
+		return NULL;
+	}
+	/* Use sq_item rather than getlistitem(), so lists of numbers
+	   don't have to be boxed in place */
+	n = (*seq->ob_type->tp_as_sequence->sq_length)(seq);
+	getitem = seq->ob_type->tp_as_sequence->sq_item;
+	a = newarrayobject(typecode, n);
+	if (a == NULL)
+		return NULL;
+	for (i = 0; i < n; i++) {
+		if ((v = (*getitem)(seq, i)) == NULL) {
+			DECREF(a);
+			return NULL;
+		}
+		if (setarrayitem((arrayobject *)a, i, v) < 0) {
+			DECREF(v);
+			DECREF(a);
+			return NULL;
+		}
+		DECREF(v);
+	}
+	return a;
+}
+
+/* Apply a function of one double to all items, giving a 'd' array */
+
+object *
+arrayapply(op, func)
+	object *op;
+	double (*func) FPROTO((double));
+{
+	register arrayobject *a = (arrayobject *)op;
+	register double *zp;
+	register int i, n;
+	object *z;
+	if (!is_arrayobject(op)) {
+		err_badcall();
+		return NULL;
+	}
+	n = a->ob_size;
+	z = newarrayobject('d', n);
+	if (z == NULL)
+		return NULL;
+	zp = DPTR((arrayobject *)z);
+	errno = 0;
+	switch (a->ob_typecode) {
+	case 'i':
+		for (i = 0; i < n; i++)
+			zp[i] = (*func)((double) IPTR(a)[i]);
+		break;
+	case 'l':
+		for (i = 0; i < n; i++)
+			zp[i] = (*func)((double) LPTR(a)[i]);
+		break;
+	default:
+		for (i = 0; i < n; i++)
+			zp[i] = (*func)(DPTR(a)[i]);
+		break;
+	}
+	if (errno != 0) {
+		DECREF(z);
+		return err_errno(RuntimeError);
+	}
+	return z;
+}
+
+/* Methods */
+
+static void
+array_dealloc(op)
+	arrayobject *op;
+{
+	free(op->ob_item);
+	DEL(op);
+}
+
+static void
+array_print(a, fp, flags)
+	arrayobject *a;
+	FILE *fp;
+	int flags;
+{
+	int i;
+	object *v;
+	fprintf(fp, "array('%c', [", a->ob_typecode);
+	for (i = 0; i < a->ob_size && !StopPrint; i++) {
+		if (i > 0)
+			fprintf(fp, ", ");
+		v = getarrayitem(a, i);
+		if (v == NULL) {
+			err_clear();
+			break;
+		}
+		printobject(v, fp, flags);
+		DECREF(v);
+	}
+	fprintf(fp, "])");
+}
+
+static object *
+array_repr(a)
+	arrayobject *a;
+{
+	object *s, *t, *comma;
+	char buf[20];
+	int i;
+	sprintf(buf, "array('%c', [", a->ob_typecode);
+	s = newstringobject(buf);
+	comma = newstringobject(", ");
+	for (i = 0; i < a->ob_size && s != NULL; i++) {
+		if (i > 0)
+			joinstring(&s, comma);
+		t = getarrayitem(a, i);
+		if (t != NULL) {
+			object *r = reprobject(t);
+			DECREF(t);
+			t = r;
+		}
+		joinstring(&s, t);
+		if (t != NULL) {
+			DECREF(t);
+		}
+	}
+	DECREF(comma);
+	t = newstringobject("])");
+	joinstring(&s, t);
+	DECREF(t);
+	return s;
+}
+
+static int
+array_compare(a, b)
+	arrayobject *a, *b;
+{
+	int len = (a->ob_size < b->ob_size) ? a->ob_size : b->ob_size;
+	int i;
+	double x, y;
+	for (i = 0; i < len; i++) {
+		if (a->ob_typecode == 'l' && b->ob_typecode == 'l') {
+			if (LPTR(a)[i] != LPTR(b)[i])
+				return LPTR(a)[i] < LPTR(b)[i] ? -1 : 1;
+			continue;
+		}
+		x = a->ob_typecode == 'd' ? DPTR(a)[i] :
+			a->ob_typecode == 'l' ? LPTR(a)[i] : IPTR(a)[i];
+		y = b->ob_typecode == 'd' ? DPTR(b)[i] :
+			b->ob_typecode == 'l' ? LPTR(b)[i] : IPTR(b)[i];
+		if (x != y)
+			return x < y ? -1 : 1;
+	}
+	return a->ob_size - b->ob_size;
+}
+
+static int
+array_length(a)
+	arrayobject *a;
+{
+	return a->ob_size;
+}
+
+static object *
+array_item(a, i)
+	arrayobject *a;
+	int i;
+{
+	if (i < 0 || i >= a->ob_size) {
+		err_setstr(IndexError, "array index out of range");
+		return NULL;
+	}
+	return getarrayitem(a, i);
+}
+
+static object *
+array_slice(a, ilow, ihigh)
+	arrayobject *a;
+	int ilow, ihigh;
+{
+	int n = itemsize(a->ob_typecode);
+	object *np;
+	if (ilow < 0)
+		ilow = 0;
+	else if (ilow > a->ob_size)
+		ilow = a->ob_size;
+	if (ihigh < 0)
+		ihigh = 0;
+	if (ihigh < ilow)
+		ihigh = ilow;
+	else if (ihigh > a->ob_size)
+		ihigh = a->ob_size;
+	np = newarrayobject(a->ob_typecode, ihigh - ilow);
+	if (np == NULL)
+		return NULL;
+	memcpy(((arrayobject *)np)->ob_item, a->ob_item + ilow*n,
+							(ihigh-ilow) * n);
+	return np;
+}
+
+static int
+array_ass_slice(a, ilow, ihigh, v)
+	arrayobject *a;
+	int ilow, ihigh;
+	object *v;
+{
+	int size = itemsize(a->ob_typecode);
+	char *item;
+	int n; /* Size of replacement array */
+	int d; /* Change in size */
+#define b ((arrayobject *)v)
+	if (v == NULL)
+		n = 0;
+	else if (is_arrayobject(v) && b->ob_typecode == a->ob_typecode)
+		n = b->ob_size;
+	else {
+		err_setstr(TypeError,
+			"can only assign array of same type to array slice");
+		return -1;
+	}
+	if (ilow < 0)
+		ilow = 0;
+	else if (ilow > a->ob_size)
+		ilow = a->ob_size;
+	if (ihigh < 0)
+		ihigh = 0;
+	if (ihigh < ilow)
+		ihigh = ilow;
+	else if (ihigh > a->ob_size)
+		ihigh = a->ob_size;
+	if (v == (object *)a) {
+		/* a[i:j] = a: make a copy first */
+		int err;
+		v = array_slice(b, 0, (int) b->ob_size);
+		if (v == NULL)
+			return -1;
+		err = array_ass_slice(a, ilow, ihigh, v);
+		DECREF(v);
+		return err;
+	}
+	item = a->ob_item;
+	d = n - (ihigh-ilow);
+	if (d < 0) {
+		memmove(item + (ihigh+d)*size, item + ihigh*size,
+					(a->ob_size - ihigh) * size);
+		a->ob_size += d;
+		RESIZE(item, char, a->ob_size*size + 1); /* Can't fail */
+		a->ob_item = item;
+	}
+	else if (d > 0) {
+		RESIZE(item, char, (a->ob_size + d)*size);
+		if (item == NULL) {
+			err_nomem();
+			return -1;
+		}
+		memmove(item + (ihigh+d)*size, item + ihigh*size,
+					(a->ob_size - ihigh) * size);
+		a->ob_item = item;
+		a->ob_size += d;
+	}
+	if (n > 0)
+		memcpy(item + ilow*size, b->ob_item, n*size);
+	return 0;
+#undef b
+}
+
+static int
+array_ass_item(a, i, v)
+	arrayobject *a;
+	int i;
+	object *v;
+{
+	if (i < 0 || i >= a->ob_size) {
+		err_setstr(IndexError, "array assignment index out of range");
+		return -1;
+	}
+	if (v == NULL)
+		return array_ass_slice(a, i, i+1, v);
+	return setarrayitem(a, i, v);
+}
+
+/* Elementwise arithmetic.
+   The right operand is either an array of the same type and length or
+   a single number, which is converted once and used for every item.
+   Integer addition, subtraction and multiplication are done unsigned,
+   so they wrap around instead of trapping; so does division of the
+   most negative value by -1, which is done as an unsigned negation. */
+
+#define OP_ADD	0
+#define OP_SUB	1
+#define OP_MUL	2
+#define OP_DIV	3
+
+#define ULONG unsigned long
+#define MAXLONG ((long)(~(ULONG)0 >> 1))
+
+#define VECLOOP(type, utype, zp, xp, yp, s, n, op) \
+	switch (op) { \
+	case OP_ADD: \
+		if (yp != NULL) for (i = 0; i < n; i++) \
+			zp[i] = (type) ((utype)xp[i] + (utype)yp[i]); \
+		else for (i = 0; i < n; i++) \
+			zp[i] = (type) ((utype)xp[i] + (utype)s); \
+		break; \
+	case OP_SUB: \
+		if (yp != NULL) for (i = 0; i < n; i++) \
+			zp[i] = (type) ((utype)xp[i] - (utype)yp[i]); \
+		else for (i = 0; i < n; i++) \
+			zp[i] = (type) ((utype)xp[i] - (utype)s); \
+		break; \
+	case OP_MUL: \
+		if (yp != NULL) for (i = 0; i < n; i++) \
+			zp[i] = (type) ((utype)xp[i] * (utype)yp[i]); \
+		else for (i = 0; i < n; i++) \
+			zp[i] = (type) ((utype)xp[i] * (utype)s); \
+		break; \
+	case OP_DIV: \
+		if (yp != NULL) for (i = 0; i < n; i++) \
+			zp[i] = yp[i] == -1 ? (type) -(utype)xp[i] : \
+							xp[i] / yp[i]; \
+		else if (s == -1) for (i = 0; i < n; i++) \
+			zp[i] = (type) -(utype)xp[i]; \
+		else for (i = 0; i < n; i++) \
+			zp[i] = xp[i] / s; \
+		break; \
+	}
+
+/* Check an array divisor for zeros before dividing anything */
+
+static int
+haszeros(b)
+	arrayobject *b;
+{
+	register int i;
+	switch (b->ob_typecode) {
+	case 'i':
+		for (i = 0; i < b->ob_size; i++)
+			if (IPTR(b)[i] == 0)
+				return 1;
+		break;
+	case 'l':
+		for (i = 0; i < b->ob_size; i++)
+			if (LPTR(b)[i] == 0)
+				return 1;
+		break;
+	default:
+		for (i = 0; i < b->ob_size; i++)
+			if (DPTR(b)[i] == 0.0)
+				return 1;
+		break;
+	}
+	return 0;
+}
+
+static object *
+array_arith(a, w, op)
+	arrayobject *a;
+	object *w;
+	int op;
+{
+	arrayobject *b = NULL, *z;
+	long ys = 0;
+	double yd = 0.0;
+	register int i, n = a->ob_size;
+	if (is_arrayobject(w)) {
+		b = (arrayobject *)w;
+		if (b->ob_typecode != a->ob_typecode ||
+						b->ob_size != a->ob_size) {
+			err_setstr(TypeError,
+			    "array operands must have same type and length");
+			return NULL;
+		}
+	}
+	else if (a->ob_typecode == 'd') {
+		if (getdoublenum(w, &yd) < 0)
+			return NULL;
+	}
+	else {
+		if (getlongnum(a->ob_typecode, w, &ys) < 0)
+			return NULL;
+		yd = ys;
+	}
+	if (op == OP_DIV && (b != NULL ? haszeros(b) : yd == 0.0)) {
+		err_setstr(ZeroDivisionError, "array division by zero");
+		return NULL;
+	}
+	z = (arrayobject *) newarrayobject(a->ob_typecode, n);
+	if (z == NULL)
+		return NULL;
+	switch (a->ob_typecode) {
+	case 'i':
+		{
+			register int *zp = IPTR(z), *xp = IPTR(a);
+			register int *yp = b == NULL ? NULL : IPTR(b);
+			register int s = ys;
+			VECLOOP(int, unsigned int, zp, xp, yp, s, n, op)
+		}
+		break;
+	case 'l':
+		{
+			register long *zp = LPTR(z), *xp = LPTR(a);
+			register long *yp = b == NULL ? NULL : LPTR(b);
+			register long s = ys;
+			VECLOOP(long, ULONG, zp, xp, yp, s, n, op)
+		}
+		break;
+	default:
+		{
+			register double *zp = DPTR(z), *xp = DPTR(a);
+			register double *yp = b == NULL ? NULL : DPTR(b);
+			register double s = yd;
+			VECLOOP(double, double, zp, xp, yp, s, n, op)
+		}
+		break;
+	}
+	return (object *)z;
+}
+
+static object *
+array_add(a, w)
+	arrayobject *a;
+	object *w;
+{
+	return array_arith(a, w, OP_ADD);
+}
+
+static object *
+array_sub(a, w)
+	arrayobject *a;
+	object *w;
+{
+	return array_arith(a, w, OP_SUB);
+}
+
+static object *
+array_mul(a, w)
+	arrayobject *a;
+	object *w;
+{
+	return array_arith(a, w, OP_MUL);
+}
+
+static object *
+array_div(a, w)
+	arrayobject *a;
+	object *w;
+{
+	return array_arith(a, w, OP_DIV);
+}
+
+static object *
+array_neg(a)
+	arrayobject *a;
+{
+	arrayobject *z;
+	register int i, n = a->ob_size;
+	z = (arrayobject *) newarrayobject(a->ob_typecode, n);
+	if (z == NULL)
+		return NULL;
+	switch (a->ob_typecode) {
+	case 'i':
+		for (i = 0; i < n; i++)
+			IPTR(z)[i] = - (unsigned int) IPTR(a)[i];
+		break;
+	case 'l':
+		for (i = 0; i < n; i++)
+			LPTR(z)[i] = - (ULONG) LPTR(a)[i];
+		break;
+	default:
+		for (i = 0; i < n; i++)
+			DPTR(z)[i] = - DPTR(a)[i];
+		break;
+	}
+	return (object *)z;
+}
+
+static object *
+array_pos(a)
+	arrayobject *a;
+{
+	INCREF(a);
+	return (object *)a;
+}
+
+/* Reductions.  Integer sums and dot products are accumulated in a
+   C long and raise OverflowError rather than wrapping. */
+
+static object *
+err_sumovf()
+{
+	err_setstr(OverflowError, "integer array sum overflow");
+	return NULL;
+}
+
+static object *
+array_sum(a, args)
+	arrayobject *a;
+	object *args;
+{
+	register int i, n = a->ob_size;
+	register long s, x, t;
+	register double d;
+	if (!getnoarg(args))
+		return NULL;
+	if (a->ob_typecode == 'd') {
+		d = 0.0;
+		for (i = 0; i < n; i++)
+			d += DPTR(a)[i];
+		return newfloatobject(d);
+	}
+	s = 0;
+	for (i = 0; i < n; i++) {
+		x = a->ob_typecode == 'i' ? IPTR(a)[i] : LPTR(a)[i];
+		t = (ULONG)s + (ULONG)x;
+		if ((t^s) < 0 && (t^x) < 0)
+			return err_sumovf();
+		s = t;
+	}
+	return newintobject(s);
+}
+
+static object *
+array_minmax(a, args, wantmax)
+	arrayobject *a;
+	object *args;
+	int wantmax;
+{
+	register int i, k, n = a->ob_size;
+	if (!getnoarg(args))
+		return NULL;
+	if (n == 0) {
+		err_setstr(RuntimeError, "min() or max() of empty array");
+		return NULL;
+	}
+	k = 0;
+	switch (a->ob_typecode) {
+	case 'i':
+		{
+			register int *p = IPTR(a);
+			for (i = 1; i < n; i++)
+				if (wantmax ? p[i] > p[k] : p[i] < p[k])
+					k = i;
+		}
+		break;
+	case 'l':
+		{
+			register long *p = LPTR(a);
+			for (i = 1; i < n; i++)
+				if (wantmax ? p[i] > p[k] : p[i] < p[k])
+					k = i;
+		}
+		break;
+	default:
+		{
+			register double *p = DPTR(a);
+			for (i = 1; i < n; i++)
+				if (wantmax ? p[i] > p[k] : p[i] < p[k])
+					k = i;
+		}
+		break;
+	}
+	return getarrayitem(a, k);
+}
+
+static object *
+array_min(a, args)
+	arrayobject *a;
+	object *args;
+{
+	return array_minmax(a, args, 0);
+}
+
+static object *
+array_max(a, args)
+	arrayobject *a;
+	object *args;
+{
+	return array_minmax(a, args, 1);
+}
+
+static object *
+array_dot(a, args)
+	arrayobject *a;
+	object *args;
+{
+	arrayobject *b = (arrayobject *)args;
+	register int i, n = a->ob_size;
+	register long s, x, t;
+	register double d;
+	if (args == NULL || !is_arrayobject(args) ||
+			b->ob_typecode != a->ob_typecode || b->ob_size != n) {
+		err_setstr(TypeError,
+			"dot() needs an array of the same type and length");
+		return NULL;
+	}
+	if (a->ob_typecode == 'd') {
+		register double *p = DPTR(a), *q = DPTR(b);
+		d = 0.0;
+		for (i = 0; i < n; i++)
+			d += p[i] * q[i];
+		return newfloatobject(d);
+	}
+	s = 0;
+	for (i = 0; i < n; i++) {
+		if (a->ob_typecode == 'i') {
+			x = IPTR(a)[i];
+			t = IPTR(b)[i];
+		}
+		else {
+			x = LPTR(a)[i];
+			t = LPTR(b)[i];
+		}
+		d = (double)x * (double)t;
+		if (d >= (double)MAXLONG || d <= -(double)MAXLONG)
+			return err_sumovf();
+		x = x * t;
+		t = (ULONG)s + (ULONG)x;
+		if ((t^s) < 0 && (t^x) < 0)
+			return err_sumovf();
+		s = t;
+	}
+	return newintobject(s);
+}
+
+static object *
+array_tolist(a, args)
+	arrayobject *a;
+	object *args;
+{
+	object *list, *v;
+	int i;
+	if (!getnoarg(args))
+		return NULL;
+	list = newlistobject((int) a->ob_size);
+	if (list == NULL)
+		return NULL;
+	for (i = 0; i < a->ob_size; i++) {
+		v = getarrayitem(a, i);
+		if (v == NULL || setlistitem(list, i, v) < 0) {
+			DECREF(list);
+			return NULL;
+		}
+	}
+	return list;
+}
+
+static object *
+array_append(a, args)
+	arrayobject *a;
+	object *args;
+{
+	int size = itemsize(a->ob_typecode);
+	char *item = a->ob_item;
+	if (args == NULL) {
+		err_badarg();
+		return NULL;
+	}
+	RESIZE(item, char, (a->ob_size + 1) * size);
+	if (item == NULL)
+		return err_nomem();
+	a->ob_item = item;
+	a->ob_size++;
+	if (setarrayitem(a, (int) a->ob_size - 1, args) < 0) {
+		a->ob_size--;
+		return NULL;
+	}
+	INCREF(None);
+	return None;
+}
+
+static object *
+array_typecode(a, args)
+	arrayobject *a;
+	object *args;
+{
+	char c;
+	if (!getnoarg(args))
+		return NULL;
+	c = a->ob_typecode;
+	return newsizedstringobject(&c, 1);
+}
+
+static struct methodlist array_methods[] = {
+	{"append",	array_append},
+	{"dot",		array_dot},
+	{"max",		array_max},
+	{"min",		array_min},
+	{"sum",		array_sum},
+	{"tolist",	array_tolist},
+	{"typecode",	array_typecode},
+	{NULL,		NULL}		/* sentinel */
+};
+
+static object *
+array_getattr(a, name)
+	arrayobject *a;
+	char *name;
+{
+	return findmethod(array_methods, (object *)a, name);
+}
+
+static number_methods array_as_number = {
+	array_add,	/*nb_add*/
+	array_sub,	/*nb_subtract*/
+	array_mul,	/*nb_multiply*/
+	array_div,	/*nb_divide*/
+	0,		/*nb_remainder*/
+	0,		/*nb_power*/
+	array_neg,	/*nb_negative*/
+	array_pos,	/*nb_positive*/
+};
+
+static sequence_methods array_as_sequence = {
+	array_length,	/*sq_length*/
+	0,		/*sq_concat*/
+	0,		/*sq_repeat*/
+	array_item,	/*sq_item*/
+	array_slice,	/*sq_slice*/
+	array_ass_item,	/*sq_ass_item*/
+	array_ass_slice,	/*sq_ass_slice*/
+};
+
+typeobject Arraytype = {
+	OB_HEAD_INIT(&Typetype)
+	0,
+	"array",
+	sizeof(arrayobject),
+	0,
+	array_dealloc,	/*tp_dealloc*/
+	array_print,	/*tp_print*/
+	array_getattr,	/*tp_getattr*/
+	0,		/*tp_setattr*/
+	array_compare,	/*tp_compare*/
+	array_repr,	/*tp_repr*/
+	&array_as_number,	/*tp_as_number*/
+	&array_as_sequence,	/*tp_as_sequence*/
+	0,		/*tp_as_mapping*/
+	array_methods,	/*tp_methods*/
+};
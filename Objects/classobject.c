@@ -18,8 +18,18 @@ typedef struct {
 	node	*cl_tree;	/* The entire classdef parse tree */
 	object	*cl_bases;	/* A tuple */
 	object	*cl_methods;	/* A dictionary */
+	object	*cl_cache;	/* Dictionary of names found in bases */
+	long	cl_version;	/* Value of classversion when cached */
 } classobject;
 
+/* Each class caches the attributes it finds in its bases, so a lookup
+   takes at most two dictionary lookups however deep the hierarchy is.
+   Any change to a class changes classversion, which flushes the cache
+   of every class the next time it is used (a class can't tell which
+   classes derive from it). */
+
+static long classversion;
+
 object *
 newclassobject(tree, bases, methods)
 	node *tree;
@@ -36,6 +46,8 @@ newclassobject(tree, bases, methods)
 	op->cl_bases = bases;
 	INCREF(methods);
 	op->cl_methods = methods;
+	op->cl_cache = NULL;
+	op->cl_version = classversion;
 	return (object *) op;
 }
 
@@ -49,31 +61,77 @@ class_dealloc(op)
 	if (op->cl_bases != NULL)
 		DECREF(op->cl_bases);
 	DECREF(op->cl_methods);
+	if (op->cl_cache != NULL)
+		DECREF(op->cl_cache);
 	free((ANY *)op);
 }
 
+/* Look for name in the class and its bases; no reference, no error */
+
 static object *
-class_getattr(op, name)
+class_lookup(op, name)
 	register classobject *op;
 	register char *name;
 {
 	register object *v;
+	int n, i;
 	v = dictlookup(op->cl_methods, name);
-	if (v != NULL) {
-		INCREF(v);
+	if (v != NULL || op->cl_bases == NULL)
 		return v;
-	}
-	if (op->cl_bases != NULL) {
-		int n = gettuplesize(op->cl_bases);
-		int i;
-		for (i = 0; i < n; i++) {
-			v = class_getattr(gettupleitem(op->cl_bases, i), name);
-			if (v != NULL)
-				return v;
+	if (op->cl_version != classversion) {
+		if (op->cl_cache != NULL) {
+			DECREF(op->cl_cache);
+			op->cl_cache = NULL;
 		}
+		op->cl_version = classversion;
 	}
-	err_setstr(NameError, name);
-	return NULL;
+	if (op->cl_cache != NULL) {
+		v = dictlookup(op->cl_cache, name);
+		if (v != NULL)
+			return v;
+	}
+	n = gettuplesize(op->cl_bases);
+	for (i = 0; i < n; i++) {
+		v = class_lookup((classobject *)
+				gettupleitem(op->cl_bases, i), name);
+		if (v != NULL)
+			break;
+	}
+	if (v == NULL)
+		return NULL;
+	/* Failing to cache it is no error */
+	if (op->cl_cache == NULL)
+		op->cl_cache = newdictobject();
+	if (op->cl_cache == NULL || dictinsert(op->cl_cache, name, v) != 0)
+		err_clear();
+	return v;
+}
+
+static object *
+class_getattr(op, name)
+	register classobject *op;
+	register char *name;
+{
+	register object *v = class_lookup(op, name);
+	if (v == NULL) {
+		err_setstr(NameError, name);
+		return NULL;
+	}
+	INCREF(v);
+	return v;
+}
+
+static int
+class_setattr(op, name, v)
+	classobject *op;
+	char *name;
+	object *v;
+{
+	classversion++;
+	if (v == NULL)
+		return dictremove(op->cl_methods, name);
+	else
+		return dictinsert(op->cl_methods, name, v);
 }
 
 typeobject Classtype = {
@@ -85,7 +143,7 @@ typeobject Classtype = {
 	class_dealloc,	/*tp_dealloc*/
 	0,		/*tp_print*/
 	class_getattr,	/*tp_getattr*/
-	0,		/*tp_setattr*/
+	class_setattr,	/*tp_setattr*/
 	0,		/*tp_compare*/
 	0,		/*tp_repr*/
 	0,		/*tp_as_number*/
@@ -159,6 +217,27 @@ classmember_getattr(cm, name)
 	return NULL;
 }
 
+/* Return the function that implements method name of class member cm,
+   or NULL without an error if name is not a method (e.g. it is set in
+   the member itself).  This lets the interpreter call a method without
+   making a class method object. */
+
+object *
+classmembergetfunc(cm, name)
+	register object *cm;
+	register char *name;
+{
+	register object *v;
+	if (!is_classmemberobject(cm) ||
+		dictlookup(((classmemberobject *)cm)->cm_attr, name) != NULL)
+		return NULL;
+	v = class_lookup(((classmemberobject *)cm)->cm_class, name);
+	if (v == NULL || !is_funcobject(v))
+		return NULL;
+	INCREF(v);
+	return v;
+}
+
 static int
 classmember_setattr(cm, name, v)
 	classmemberobject *cm;
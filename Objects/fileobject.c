@@ -14,6 +14,7 @@
 #include "fileobject.h"
 #include "methodobject.h"
 #include "objimpl.h"
+#include "modsupport.h"
 #include "errors.h"
 
 typedef struct {
@@ -232,10 +233,7 @@ filewrite(f, args)
 	return None;
 }
 
-static struct methodlist {
-	char *ml_name;
-	method ml_meth;
-} filemethods[] = {
+static struct methodlist filemethods[] = {
 	{"write",	filewrite},
 	{"read",	fileread},
 	{"readline",	filereadline},
@@ -248,14 +246,7 @@ filegetattr(f, name)
 	fileobject *f;
 	char *name;
 {
-	struct methodlist *ml = filemethods;
-	for (; ml->ml_name != NULL; ml++) {
-		if (strcmp(name, ml->ml_name) == 0)
-			return newmethodobject(ml->ml_name, ml->ml_meth,
-				(object *)f);
-	}
-	err_setstr(NameError, name);
-	return NULL;
+	return findmethod(filemethods, (object *)f, name);
 }
 
 typeobject Filetype = {
@@ -270,4 +261,8 @@ typeobject Filetype = {
 	0,		/*tp_setattr*/
 	0,		/*tp_compare*/
 	filerepr,	/*tp_repr*/
+	0,		/*tp_as_number*/
+	0,		/*tp_as_sequence*/
+	0,		/*tp_as_mapping*/
+	filemethods,	/*tp_methods*/
 };
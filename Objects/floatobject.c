@@ -47,18 +47,117 @@ getfloatvalue(op)
 
 /* Methods */
 
+/* Convert a decimal string to a double.
+   Numbers with at most 15 significant digits and a decimal exponent
+   within 22 of the digits are computed with a single multiplication or
+   division of two exactly representable doubles, which is correctly
+   rounded.  Everything else is passed on to strtod(). */
+
+static double pow10tab[] = {
+	1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10,
+	1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20,
+	1e21, 1e22,
+};
+
+double
+parsefloat(s, p_end)
+	char *s;
+	char **p_end; /* May be NULL */
+{
+	extern double strtod();
+	register char *p = s;
+	register int c;
+	double m = 0.0; /* Significant digits seen so far */
+	int ndigits = 0, nzeros = 0, nfrac = 0, exp, eexp, esign;
+	int neg = 0, point = 0, seen = 0;
+	
+	if (*p == '-' || *p == '+')
+		neg = (*p++ == '-');
+	for (;; p++) {
+		c = *p;
+		if (c == '.' && !point) {
+			point = 1;
+			continue;
+		}
+		if (c < '0' || c > '9')
+			break;
+		seen = 1;
+		if (point)
+			nfrac++;
+		if (c == '0') {
+			/* Postpone zeros; if they are trailing they go
+			   into the exponent instead of the digits */
+			if (ndigits > 0)
+				nzeros++;
+			continue;
+		}
+		if (ndigits + nzeros >= 15)
+			goto slow;
+		for (; nzeros > 0; nzeros--) {
+			m *= 10.0;
+			ndigits++;
+		}
+		m = m*10.0 + (c - '0');
+		ndigits++;
+	}
+	if (!seen)
+		goto slow;
+	exp = nzeros - nfrac;
+	if (c == 'e' || c == 'E') {
+		char *q = p+1;
+		esign = 1;
+		if (*q == '-' || *q == '+')
+			esign = (*q++ == '-') ? -1 : 1;
+		if (*q >= '0' && *q <= '9') {
+			/* Otherwise 'e' is not part of the number */
+			for (eexp = 0; *q >= '0' && *q <= '9'; q++) {
+				if (eexp > 1000)
+					goto slow;
+				eexp = eexp*10 + (*q - '0');
+			}
+			exp += esign*eexp;
+			p = q;
+		}
+	}
+	if (ndigits == 0)
+		exp = 0;
+	if (exp < -22 || exp > 22)
+		goto slow;
+	if (exp < 0)
+		m /= pow10tab[-exp];
+	else
+		m *= pow10tab[exp];
+	if (p_end != NULL)
+		*p_end = p;
+	return neg ? -m : m;
+	
+ slow:
+	return strtod(s, p_end);
+}
+
 static void
 float_buf_repr(buf, v)
 	char *buf;
 	floatobject *v;
 {
 	register char *cp;
+	int prec;
 	/* Subroutine for float_repr and float_print.
+	   Use the shortest of %.15g, %.16g and %.17g that reads back as
+	   the same number: every double is uniquely identified by 17
+	   digits, and every decimal with at most 15 digits survives a
+	   round trip, so this is lossless and usually short.
 	   We want float numbers to be recognizable as such,
 	   i.e., they should contain a decimal point or an exponent.
 	   However, %g may print the number as an integer;
 	   in such cases, we append ".0" to the string. */
-	sprintf(buf, "%.12g", v->ob_fval);
+	for (prec = 15; prec < 17; prec++) {
+		sprintf(buf, "%.*g", prec, v->ob_fval);
+		if (parsefloat(buf, (char **)NULL) == v->ob_fval)
+			break;
+	}
+	if (prec == 17)
+		sprintf(buf, "%.17g", v->ob_fval);
 	cp = buf;
 	if (*cp == '-')
 		cp++;
@@ -5,6 +5,7 @@
 #include "PROTO.h"
 #include "object.h"
 #include "intobject.h"
+#include "longobject.h"
 #include "stringobject.h"
 #include "objimpl.h"
 #include "errors.h"
@@ -19,12 +20,7 @@ intobject TrueObject = {
 	1
 };
 
-static object *
-err_ovf()
-{
-	err_setstr(OverflowError, "integer overflow");
-	return NULL;
-}
+#define MAXLONG ((long)(~(unsigned long)0 >> 1))
 
 static object *
 err_zdiv()
@@ -64,22 +60,57 @@ getintvalue(op)
 
 /* Methods */
 
+/* Convert a long to decimal, two digits at a time, working backwards
+   from the end of the buffer; returns a pointer to the first character.
+   The buffer must have room for the digits, the sign and a null byte. */
+
+static char digitpairs[] =
+	"00010203040506070809101112131415161718192021222324252627282930313233343536373839404142434445464748495051525354555657585960616263646566676869707172737475767778798081828384858687888990919293949596979899";
+
+#define INTBUFSIZE (3*sizeof(long) + 2)
+
+static char *
+int_buf_repr(buf, ival)
+	char *buf; /* Size INTBUFSIZE */
+	long ival;
+{
+	register char *p = buf + INTBUFSIZE - 1;
+	register unsigned long x;
+	register char *q;
+	x = ival < 0 ? -(unsigned long)ival : ival;
+	*p = '\0';
+	while (x >= 100) {
+		q = digitpairs + 2*(x % 100);
+		x /= 100;
+		*--p = q[1];
+		*--p = q[0];
+	}
+	q = digitpairs + 2*x;
+	*--p = q[1];
+	if (x >= 10)
+		*--p = q[0];
+	if (ival < 0)
+		*--p = '-';
+	return p;
+}
+
 static void
 intprint(v, fp, flags)
 	intobject *v;
 	FILE *fp;
 	int flags;
 {
-	fprintf(fp, "%ld", v->ob_ival);
+	char buf[INTBUFSIZE];
+	fputs(int_buf_repr(buf, v->ob_ival), fp);
 }
 
 static object *
 intrepr(v)
 	intobject *v;
 {
-	char buf[20];
-	sprintf(buf, "%ld", v->ob_ival);
-	return newstringobject(buf);
+	char buf[INTBUFSIZE];
+	register char *p = int_buf_repr(buf, v->ob_ival);
+	return newsizedstringobject(p, (int) (buf + INTBUFSIZE - 1 - p));
 }
 
 static int
@@ -91,6 +122,27 @@ intcompare(v, w)
 	return (i < j) ? -1 : (i > j) ? 1 : 0;
 }
 
+/* Redo a binary operation in long arithmetic.  This is used when the
+   result overflows, and when the right operand is a long integer. */
+
+static object *
+long_redo(v, w, meth)
+	intobject *v;
+	object *w;
+	object *(*meth) FPROTO((object *, object *));
+{
+	object *lv, *x;
+	lv = newlongobject(v->ob_ival);
+	if (lv == NULL)
+		return NULL;
+	x = (*meth)(lv, w);
+	DECREF(lv);
+	return x;
+}
+
+#define LONG_REDO(v, w, slot) \
+	long_redo(v, w, Longtype.tp_as_number->slot)
+
 static object *
 intadd(v, w)
 	intobject *v;
@@ -98,6 +150,8 @@ intadd(v, w)
 {
 	register long a, b, x;
 	if (!is_intobject(w)) {
+		if (is_longobject(w))
+			return LONG_REDO(v, w, nb_add);
 		err_badarg();
 		return NULL;
 	}
@@ -105,7 +159,7 @@ intadd(v, w)
 	b = ((intobject *)w) -> ob_ival;
 	x = a + b;
 	if ((x^a) < 0 && (x^b) < 0)
-		return err_ovf();
+		return LONG_REDO(v, w, nb_add);
 	return newintobject(x);
 }
 
@@ -116,6 +170,8 @@ intsub(v, w)
 {
 	register long a, b, x;
 	if (!is_intobject(w)) {
+		if (is_longobject(w))
+			return LONG_REDO(v, w, nb_subtract);
 		err_badarg();
 		return NULL;
 	}
@@ -123,7 +179,7 @@ intsub(v, w)
 	b = ((intobject *)w) -> ob_ival;
 	x = a - b;
 	if ((x^a) < 0 && (x^~b) < 0)
-		return err_ovf();
+		return LONG_REDO(v, w, nb_subtract);
 	return newintobject(x);
 }
 
@@ -135,14 +191,18 @@ intmul(v, w)
 	register long a, b;
 	double x;
 	if (!is_intobject(w)) {
+		if (is_longobject(w))
+			return LONG_REDO(v, w, nb_multiply);
 		err_badarg();
 		return NULL;
 	}
 	a = v->ob_ival;
 	b = ((intobject *)w) -> ob_ival;
+	/* The double product is accurate enough to tell safe cases
+	   from those that may overflow, which are done in long */
 	x = (double)a * (double)b;
-	if (x > 0x7fffffff || x < (double) (long) 0x80000000)
-		return err_ovf();
+	if (x > (double)(MAXLONG/2) || x < -(double)(MAXLONG/2))
+		return LONG_REDO(v, w, nb_multiply);
 	return newintobject(a * b);
 }
 
@@ -151,13 +211,19 @@ intdiv(v, w)
 	intobject *v;
 	register object *w;
 {
+	register long b;
 	if (!is_intobject(w)) {
+		if (is_longobject(w))
+			return LONG_REDO(v, w, nb_divide);
 		err_badarg();
 		return NULL;
 	}
-	if (((intobject *)w) -> ob_ival == 0)
+	b = ((intobject *)w) -> ob_ival;
+	if (b == 0)
 		return err_zdiv();
-	return newintobject(v->ob_ival / ((intobject *)w) -> ob_ival);
+	if (b == -1 && v->ob_ival < -MAXLONG) /* -MAXLONG-1 / -1 */
+		return LONG_REDO(v, w, nb_divide);
+	return newintobject(v->ob_ival / b);
 }
 
 static object *
@@ -165,40 +231,63 @@ intrem(v, w)
 	intobject *v;
 	register object *w;
 {
+	register long b;
 	if (!is_intobject(w)) {
+		if (is_longobject(w))
+			return LONG_REDO(v, w, nb_remainder);
 		err_badarg();
 		return NULL;
 	}
-	if (((intobject *)w) -> ob_ival == 0)
+	b = ((intobject *)w) -> ob_ival;
+	if (b == 0)
 		return err_zdiv();
-	return newintobject(v->ob_ival % ((intobject *)w) -> ob_ival);
+	if (b == -1) /* Avoid overflow trap for -MAXLONG-1 % -1 */
+		return newintobject(0L);
+	return newintobject(v->ob_ival % b);
 }
 
+/* Exponentiation by repeated squaring; on overflow the whole
+   computation is redone in long arithmetic */
+
 static object *
 intpow(v, w)
 	intobject *v;
 	register object *w;
 {
 	register long iv, iw, ix;
-	register int neg;
+	double x;
 	if (!is_intobject(w)) {
+		if (is_longobject(w))
+			return LONG_REDO(v, w, nb_power);
 		err_badarg();
 		return NULL;
 	}
 	iv = v->ob_ival;
 	iw = ((intobject *)w)->ob_ival;
-	neg = 0;
-	if (iw < 0)
-		neg = 1, iw = -iw;
-	ix = 1;
-	for (; iw > 0; iw--)
-		ix = ix * iv;
-	if (neg) {
-		if (ix == 0)
+	if (iw < 0) {
+		/* 1/(iv**-iw), truncated */
+		if (iv == 0)
 			return err_zdiv();
-		ix = 1/ix;
+		if (iv == 1 || iv == -1)
+			return newintobject((iw & 1) ? iv : 1L);
+		return newintobject(0L);
+	}
+	ix = 1;
+	for (;;) {
+		if (iw & 1) {
+			x = (double)ix * (double)iv;
+			if (x > (double)(MAXLONG/2) || x < -(double)(MAXLONG/2))
+				return LONG_REDO(v, w, nb_power);
+			ix = ix * iv;
+		}
+		iw >>= 1;
+		if (iw == 0)
+			break;
+		x = (double)iv * (double)iv;
+		if (x > (double)(MAXLONG/2))
+			return LONG_REDO(v, w, nb_power);
+		iv = iv * iv;
 	}
-	/* XXX How to check for overflow? */
 	return newintobject(ix);
 }
 
@@ -209,8 +298,14 @@ intneg(v)
 	register long a, x;
 	a = v->ob_ival;
 	x = -a;
-	if (a < 0 && x < 0)
-		return err_ovf();
+	if (a < 0 && x < 0) {
+		object *lv, *z;
+		if ((lv = newlongobject(a)) == NULL)
+			return NULL;
+		z = (*Longtype.tp_as_number->nb_negative)(lv);
+		DECREF(lv);
+		return z;
+	}
 	return newintobject(x);
 }
 
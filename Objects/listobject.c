@@ -1,10 +1,12 @@
 /* List object implementation */
 
 #include <stdio.h>
+#include "string.h"
 
 #include "PROTO.h"
 #include "object.h"
 #include "intobject.h"
+#include "floatobject.h"
 #include "stringobject.h"
 #include "tupleobject.h"
 #include "methodobject.h"
@@ -13,11 +15,112 @@
 #include "modsupport.h"
 #include "errors.h"
 
+/* Storage strategies.
+   A list whose items are all plain integers, or all floats, stores the
+   bare C values in ob_ival or ob_fval instead of pointers to boxed
+   objects in ob_item; items are boxed when they are extracted.  Storing
+   anything else switches the list to the general strategy for good
+   (it "generalizes").  An empty list picks its strategy when its first
+   item is inserted.  Lists made by newlistobject() with a nonzero size
+   are general, since their items are filled in by setlistitem().
+   Functions that hand out borrowed references to items, like
+   getlistitem(), generalize the list first. */
+
+#define LS_OBJECT	0	/* ob_item is used */
+#define LS_INT		1	/* ob_ival is used */
+#define LS_FLOAT	2	/* ob_fval is used */
+
 typedef struct {
 	OB_VARHEAD
+	int ob_strategy;
 	object **ob_item;
+	long *ob_ival;
+	double *ob_fval;
 } listobject;
 
+static int list_ass_slice PROTO((listobject *, int, int, object *));
+
+/* The strategy that can hold v */
+
+static int
+strategyfor(v)
+	object *v;
+{
+	if (is_intobject(v))
+		return LS_INT;
+	if (is_floatobject(v))
+		return LS_FLOAT;
+	return LS_OBJECT;
+}
+
+/* Return item i as a new reference, boxing it if necessary */
+
+static object *
+list_box(a, i)
+	listobject *a;
+	int i;
+{
+	switch (a->ob_strategy) {
+	case LS_INT:
+		return newintobject(a->ob_ival[i]);
+	case LS_FLOAT:
+		return newfloatobject(a->ob_fval[i]);
+	}
+	INCREF(a->ob_item[i]);
+	return a->ob_item[i];
+}
+
+/* Switch to the general strategy, boxing all items */
+
+static int
+generalize(a)
+	listobject *a;
+{
+	object **item;
+	int i;
+	if (a->ob_strategy == LS_OBJECT)
+		return 0;
+	item = NULL;
+	if (a->ob_size > 0) {
+		item = NEW(object *, a->ob_size);
+		if (item == NULL) {
+			err_nomem();
+			return -1;
+		}
+		for (i = 0; i < a->ob_size; i++) {
+			if ((item[i] = list_box(a, i)) == NULL) {
+				while (--i >= 0)
+					DECREF(item[i]);
+				DEL(item);
+				return -1;
+			}
+		}
+	}
+	XDEL(a->ob_ival);
+	XDEL(a->ob_fval);
+	a->ob_ival = NULL;
+	a->ob_fval = NULL;
+	a->ob_item = item;
+	a->ob_strategy = LS_OBJECT;
+	return 0;
+}
+
+/* Make an empty list use the given strategy */
+
+static void
+setstrategy(a, strategy)
+	listobject *a;
+	int strategy;
+{
+	XDEL(a->ob_item);
+	XDEL(a->ob_ival);
+	XDEL(a->ob_fval);
+	a->ob_item = NULL;
+	a->ob_ival = NULL;
+	a->ob_fval = NULL;
+	a->ob_strategy = strategy;
+}
+
 object *
 newlistobject(size)
 	int size;
@@ -45,11 +148,43 @@ newlistobject(size)
 	NEWREF(op);
 	op->ob_type = &Listtype;
 	op->ob_size = size;
+	op->ob_strategy = LS_OBJECT;
+	op->ob_ival = NULL;
+	op->ob_fval = NULL;
 	for (i = 0; i < size; i++)
 		op->ob_item[i] = NULL;
 	return (object *) op;
 }
 
+/* Make a new, empty list with the same strategy as a, with room
+   for size items */
+
+static listobject *
+newlistlike(a, size)
+	listobject *a;
+	int size;
+{
+	listobject *np;
+	if (a->ob_strategy == LS_OBJECT)
+		return (listobject *) newlistobject(size);
+	np = (listobject *) newlistobject(0);
+	if (np == NULL)
+		return NULL;
+	np->ob_strategy = a->ob_strategy;
+	if (size > 0) {
+		if (a->ob_strategy == LS_INT)
+			np->ob_ival = NEW(long, size);
+		else
+			np->ob_fval = NEW(double, size);
+		if (np->ob_ival == NULL && np->ob_fval == NULL) {
+			DECREF(np);
+			return (listobject *) err_nomem();
+		}
+	}
+	np->ob_size = size;
+	return np;
+}
+
 int
 getlistsize(op)
 	object *op;
@@ -75,6 +210,9 @@ getlistitem(op, i)
 		err_setstr(IndexError, "list index out of range");
 		return NULL;
 	}
+	/* The caller gets a borrowed reference, so it must be boxed */
+	if (generalize((listobject *)op) < 0)
+		return NULL;
 	return ((listobject *)op) -> ob_item[i];
 }
 
@@ -97,6 +235,22 @@ setlistitem(op, i, newitem)
 		err_setstr(IndexError, "list assignment index out of range");
 		return -1;
 	}
+#define a ((listobject *)op)
+	if (a->ob_strategy != LS_OBJECT && newitem != NULL &&
+			strategyfor(newitem) == a->ob_strategy) {
+		if (a->ob_strategy == LS_INT)
+			a->ob_ival[i] = getintvalue(newitem);
+		else
+			a->ob_fval[i] = getfloatvalue(newitem);
+		DECREF(newitem);
+		return 0;
+	}
+	if (generalize(a) < 0) {
+		if (newitem != NULL)
+			DECREF(newitem);
+		return -1;
+	}
+#undef a
 	olditem = ((listobject *)op) -> ob_item[i];
 	((listobject *)op) -> ob_item[i] = newitem;
 	if (olditem != NULL)
@@ -116,16 +270,48 @@ ins1(self, where, v)
 		err_badcall();
 		return -1;
 	}
+	if (where < 0)
+		where = 0;
+	if (where > self->ob_size)
+		where = self->ob_size;
+	if (self->ob_size == 0 && self->ob_strategy != strategyfor(v))
+		setstrategy(self, strategyfor(v));
+	if (self->ob_strategy == LS_INT && is_intobject(v)) {
+		long *ival = self->ob_ival;
+		RESIZE(ival, long, self->ob_size+1);
+		if (ival == NULL) {
+			err_nomem();
+			return -1;
+		}
+		for (i = self->ob_size; --i >= where; )
+			ival[i+1] = ival[i];
+		ival[where] = getintvalue(v);
+		self->ob_ival = ival;
+		self->ob_size++;
+		return 0;
+	}
+	if (self->ob_strategy == LS_FLOAT && is_floatobject(v)) {
+		double *fval = self->ob_fval;
+		RESIZE(fval, double, self->ob_size+1);
+		if (fval == NULL) {
+			err_nomem();
+			return -1;
+		}
+		for (i = self->ob_size; --i >= where; )
+			fval[i+1] = fval[i];
+		fval[where] = getfloatvalue(v);
+		self->ob_fval = fval;
+		self->ob_size++;
+		return 0;
+	}
+	if (generalize(self) < 0)
+		return -1;
 	items = self->ob_item;
 	RESIZE(items, object *, self->ob_size+1);
 	if (items == NULL) {
 		err_nomem();
 		return -1;
 	}
-	if (where < 0)
-		where = 0;
-	if (where > self->ob_size)
-		where = self->ob_size;
 	for (i = self->ob_size; --i >= where; )
 		items[i+1] = items[i];
 	INCREF(v);
@@ -168,12 +354,16 @@ list_dealloc(op)
 	listobject *op;
 {
 	int i;
-	for (i = 0; i < op->ob_size; i++) {
-		if (op->ob_item[i] != NULL)
-			DECREF(op->ob_item[i]);
+	if (op->ob_strategy == LS_OBJECT) {
+		for (i = 0; i < op->ob_size; i++) {
+			if (op->ob_item[i] != NULL)
+				DECREF(op->ob_item[i]);
+		}
 	}
 	if (op->ob_item != NULL)
 		free((ANY *)op->ob_item);
+	XDEL(op->ob_ival);
+	XDEL(op->ob_fval);
 	free((ANY *)op);
 }
 
@@ -184,12 +374,18 @@ list_print(op, fp, flags)
 	int flags;
 {
 	int i;
+	object *v;
 	fprintf(fp, "[");
 	for (i = 0; i < op->ob_size && !StopPrint; i++) {
 		if (i > 0) {
 			fprintf(fp, ", ");
 		}
-		printobject(op->ob_item[i], fp, flags);
+		if ((v = list_box(op, i)) == NULL) {
+			err_clear();
+			break;
+		}
+		printobject(v, fp, flags);
+		DECREF(v);
 	}
 	fprintf(fp, "]");
 }
@@ -205,9 +401,15 @@ list_repr(v)
 	for (i = 0; i < v->ob_size && s != NULL; i++) {
 		if (i > 0)
 			joinstring(&s, comma);
-		t = reprobject(v->ob_item[i]);
+		if ((t = list_box(v, i)) != NULL) {
+			object *r = reprobject(t);
+			DECREF(t);
+			t = r;
+		}
 		joinstring(&s, t);
-		DECREF(t);
+		if (t != NULL) {
+			DECREF(t);
+		}
 	}
 	DECREF(comma);
 	t = newstringobject("]");
@@ -221,11 +423,50 @@ list_compare(v, w)
 	listobject *v, *w;
 {
 	int len = (v->ob_size < w->ob_size) ? v->ob_size : w->ob_size;
-	int i;
-	for (i = 0; i < len; i++) {
-		int cmp = cmpobject(v->ob_item[i], w->ob_item[i]);
-		if (cmp != 0)
-			return cmp;
+	int i, cmp;
+	object *x, *y;
+	if (v->ob_strategy == LS_INT && w->ob_strategy == LS_INT) {
+		register long *p = v->ob_ival, *q = w->ob_ival;
+		for (i = 0; i < len; i++) {
+			if (p[i] != q[i])
+				return p[i] < q[i] ? -1 : 1;
+		}
+	}
+	else if (v->ob_strategy == LS_FLOAT && w->ob_strategy == LS_FLOAT) {
+		register double *p = v->ob_fval, *q = w->ob_fval;
+		for (i = 0; i < len; i++) {
+			if (p[i] != q[i])
+				return p[i] < q[i] ? -1 : 1;
+		}
+	}
+	else if (v->ob_strategy == LS_OBJECT && w->ob_strategy == LS_OBJECT) {
+		for (i = 0; i < len; i++) {
+			cmp = cmpobject(v->ob_item[i], w->ob_item[i]);
+			if (cmp != 0)
+				return cmp;
+		}
+	}
+	else {
+		for (i = 0; i < len; i++) {
+			x = list_box(v, i);
+			y = list_box(w, i);
+			if (x == NULL || y == NULL) {
+				/* Out of memory; treat as unequal */
+				if (x != NULL) {
+					DECREF(x);
+				}
+				if (y != NULL) {
+					DECREF(y);
+				}
+				err_clear();
+				return v < w ? -1 : 1;
+			}
+			cmp = cmpobject(x, y);
+			DECREF(x);
+			DECREF(y);
+			if (cmp != 0)
+				return cmp;
+		}
 	}
 	return v->ob_size - w->ob_size;
 }
@@ -246,8 +487,7 @@ list_item(a, i)
 		err_setstr(IndexError, "list index out of range");
 		return NULL;
 	}
-	INCREF(a->ob_item[i]);
-	return a->ob_item[i];
+	return list_box(a, i);
 }
 
 static object *
@@ -267,9 +507,19 @@ list_slice(a, ilow, ihigh)
 		ihigh = ilow;
 	else if (ihigh > a->ob_size)
 		ihigh = a->ob_size;
-	np = (listobject *) newlistobject(ihigh - ilow);
+	np = newlistlike(a, ihigh - ilow);
 	if (np == NULL)
 		return NULL;
+	if (a->ob_strategy == LS_INT) {
+		memcpy((char *)np->ob_ival, (char *)(a->ob_ival + ilow),
+					(ihigh - ilow) * sizeof(long));
+		return (object *)np;
+	}
+	if (a->ob_strategy == LS_FLOAT) {
+		memcpy((char *)np->ob_fval, (char *)(a->ob_fval + ilow),
+					(ihigh - ilow) * sizeof(double));
+		return (object *)np;
+	}
 	for (i = ilow; i < ihigh; i++) {
 		object *v = a->ob_item[i];
 		INCREF(v);
@@ -292,19 +542,43 @@ list_concat(a, bb)
 	}
 #define b ((listobject *)bb)
 	size = a->ob_size + b->ob_size;
+	if (a->ob_strategy == b->ob_strategy && a->ob_strategy != LS_OBJECT) {
+		np = newlistlike(a, size);
+		if (np == NULL)
+			return NULL;
+		if (a->ob_strategy == LS_INT) {
+			memcpy((char *)np->ob_ival, (char *)a->ob_ival,
+						a->ob_size * sizeof(long));
+			memcpy((char *)(np->ob_ival + a->ob_size),
+				(char *)b->ob_ival, b->ob_size * sizeof(long));
+		}
+		else {
+			memcpy((char *)np->ob_fval, (char *)a->ob_fval,
+						a->ob_size * sizeof(double));
+			memcpy((char *)(np->ob_fval + a->ob_size),
+				(char *)b->ob_fval, b->ob_size * sizeof(double));
+		}
+		return (object *)np;
+	}
+	if (a->ob_size == 0 && b->ob_strategy != LS_OBJECT)
+		return list_slice(b, 0, (int) b->ob_size);
+	if (b->ob_size == 0 && a->ob_strategy != LS_OBJECT)
+		return list_slice(a, 0, (int) a->ob_size);
 	np = (listobject *) newlistobject(size);
 	if (np == NULL) {
 		return err_nomem();
 	}
 	for (i = 0; i < a->ob_size; i++) {
-		object *v = a->ob_item[i];
-		INCREF(v);
-		np->ob_item[i] = v;
+		if ((np->ob_item[i] = list_box(a, i)) == NULL) {
+			DECREF(np);
+			return NULL;
+		}
 	}
 	for (i = 0; i < b->ob_size; i++) {
-		object *v = b->ob_item[i];
-		INCREF(v);
-		np->ob_item[i + a->ob_size] = v;
+		if ((np->ob_item[i + a->ob_size] = list_box(b, i)) == NULL) {
+			DECREF(np);
+			return NULL;
+		}
 	}
 	return (object *)np;
 #undef b
@@ -322,12 +596,68 @@ list_ass_item(a, i, v)
 	}
 	if (v == NULL)
 		return list_ass_slice(a, i, i+1, v);
+	if (a->ob_strategy != LS_OBJECT && strategyfor(v) == a->ob_strategy) {
+		if (a->ob_strategy == LS_INT)
+			a->ob_ival[i] = getintvalue(v);
+		else
+			a->ob_fval[i] = getfloatvalue(v);
+		return 0;
+	}
+	if (generalize(a) < 0)
+		return -1;
 	INCREF(v);
 	DECREF(a->ob_item[i]);
 	a->ob_item[i] = v;
 	return 0;
 }
 
+/* Slice assignment for unboxed lists, where b (if n > 0) has the same
+   strategy as a; the bounds have already been clipped */
+
+static int
+raw_ass_slice(a, ilow, ihigh, b, n)
+	listobject *a;
+	int ilow, ihigh;
+	listobject *b;
+	int n;
+{
+	char *item, *src;
+	int size, d;
+	size = a->ob_strategy == LS_INT ? sizeof(long) : sizeof(double);
+	if (a->ob_strategy == LS_INT) {
+		item = (char *)a->ob_ival;
+		src = n > 0 ? (char *)b->ob_ival : NULL;
+	}
+	else {
+		item = (char *)a->ob_fval;
+		src = n > 0 ? (char *)b->ob_fval : NULL;
+	}
+	d = n - (ihigh-ilow);
+	if (d < 0) {
+		memmove(item + (ihigh+d)*size, item + ihigh*size,
+					(a->ob_size - ihigh) * size);
+		a->ob_size += d;
+		RESIZE(item, char, a->ob_size*size + 1); /* Can't fail */
+	}
+	else if (d > 0) {
+		RESIZE(item, char, (a->ob_size + d)*size);
+		if (item == NULL) {
+			err_nomem();
+			return -1;
+		}
+		memmove(item + (ihigh+d)*size, item + ihigh*size,
+					(a->ob_size - ihigh) * size);
+		a->ob_size += d;
+	}
+	if (n > 0)
+		memcpy(item + ilow*size, src, n*size);
+	if (a->ob_strategy == LS_INT)
+		a->ob_ival = (long *)item;
+	else
+		a->ob_fval = (double *)item;
+	return 0;
+}
+
 static int
 list_ass_slice(a, ilow, ihigh, v)
 	listobject *a;
@@ -357,6 +687,23 @@ list_ass_slice(a, ilow, ihigh, v)
 		ihigh = ilow;
 	else if (ihigh > a->ob_size)
 		ihigh = a->ob_size;
+	if (a == b) {
+		/* Special case "a[i:j] = a" -- copy b first */
+		int ret;
+		v = list_slice(b, 0, n);
+		if (v == NULL)
+			return -1;
+		ret = list_ass_slice(a, ilow, ihigh, v);
+		DECREF(v);
+		return ret;
+	}
+	if (a->ob_size == 0 && n > 0 && a->ob_strategy != b->ob_strategy)
+		setstrategy(a, b->ob_strategy);
+	if (a->ob_strategy != LS_OBJECT &&
+			(n == 0 || b->ob_strategy == a->ob_strategy))
+		return raw_ass_slice(a, ilow, ihigh, b, n);
+	if (generalize(a) < 0)
+		return -1;
 	item = a->ob_item;
 	d = n - (ihigh-ilow);
 	if (d <= 0) { /* Delete -d items; DECREF ihigh-ilow items */
@@ -384,11 +731,15 @@ list_ass_slice(a, ilow, ihigh, v)
 		a->ob_size += d;
 	}
 	for (k = 0; k < n; k++, ilow++) {
-		object *w = b->ob_item[k];
-		INCREF(w);
+		object *w = list_box(b, k);
+		if (w == NULL) {
+			/* Keep the list consistent */
+			INCREF(None);
+			w = None;
+		}
 		item[ilow] = w;
 	}
-	return 0;
+	return err_occurred() ? -1 : 0;
 #undef b
 }
 
@@ -434,6 +785,22 @@ cmp(v, w)
 	return cmpobject(* (object **) v, * (object **) w);
 }
 
+static int
+cmplong(v, w)
+	char *v, *w;
+{
+	long x = * (long *) v, y = * (long *) w;
+	return x < y ? -1 : x > y ? 1 : 0;
+}
+
+static int
+cmpdouble(v, w)
+	char *v, *w;
+{
+	double x = * (double *) v, y = * (double *) w;
+	return x < y ? -1 : x > y ? 1 : 0;
+}
+
 static object *
 listsort(self, args)
 	listobject *self;
@@ -444,7 +811,15 @@ listsort(self, args)
 		return NULL;
 	}
 	err_clear();
-	if (self->ob_size > 1)
+	if (self->ob_size <= 1)
+		;
+	else if (self->ob_strategy == LS_INT)
+		qsort((char *)self->ob_ival,
+				(int) self->ob_size, sizeof(long), cmplong);
+	else if (self->ob_strategy == LS_FLOAT)
+		qsort((char *)self->ob_fval,
+				(int) self->ob_size, sizeof(double), cmpdouble);
+	else
 		qsort((char *)self->ob_item,
 				(int) self->ob_size, sizeof(object *), cmp);
 	if (err_occurred())
@@ -508,4 +883,5 @@ typeobject Listtype = {
 	0,		/*tp_as_number*/
 	&list_as_sequence,	/*tp_as_sequence*/
 	0,		/*tp_as_mapping*/
+	list_methods,	/*tp_methods*/
 };
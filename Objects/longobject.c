@@ -0,0 +1,1043 @@
+/* Long (arbitrary precision) integer object implementation */
+
+/* The algorithms are those of Knuth, The Art of Computer Programming,
+   Vol. 2, section 4.3.1 (classical arithmetic) and 4.3.3 (Karatsuba's
+   multiplication for large operands). */
+
+#include <stdio.h>
+#include "string.h"
+
+#include "PROTO.h"
+#include "object.h"
+#include "intobject.h"
+#include "longobject.h"
+#include "stringobject.h"
+#include "objimpl.h"
+#include "errors.h"
+
+#define KARATSUBA_CUTOFF 40	/* Use schoolbook below this many digits */
+
+#define MAXLONG (~(unsigned long)0 >> 1)
+
+longobject *
+alloclongobject(size)
+	int size;
+{
+	register longobject *op = (longobject *)
+		malloc(sizeof(longobject) + size * sizeof(digit));
+	if (op == NULL) {
+		err_nomem();
+		return NULL;
+	}
+	NEWREF(op);
+	op->ob_type = &Longtype;
+	op->ob_size = size;
+	op->ob_neg = 0;
+	return op;
+}
+
+/* Strip leading zero digits; zero is never negative */
+
+static longobject *
+long_normalize(v)
+	register longobject *v;
+{
+	register int i = v->ob_size;
+	while (i > 0 && v->ob_digit[i-1] == 0)
+		i--;
+	v->ob_size = i;
+	if (i == 0)
+		v->ob_neg = 0;
+	return v;
+}
+
+object *
+newlongobject(ival)
+	long ival;
+{
+	register unsigned long x, t;
+	register int i;
+	longobject *v;
+	x = ival < 0 ? -(unsigned long)ival : ival;
+	for (i = 0, t = x; t != 0; t >>= SHIFT)
+		i++;
+	v = alloclongobject(i);
+	if (v == NULL)
+		return NULL;
+	v->ob_neg = ival < 0;
+	for (i = 0; x != 0; x >>= SHIFT)
+		v->ob_digit[i++] = x & MASK;
+	return (object *)v;
+}
+
+/* Store the value of v in *p_ival if it fits in a C long;
+   return -1 (without setting an error) if it doesn't */
+
+static int
+long_aslong(v, p_ival)
+	longobject *v;
+	long *p_ival;
+{
+	register unsigned long x = 0, prev;
+	register int i = v->ob_size;
+	while (--i >= 0) {
+		prev = x;
+		x = (x << SHIFT) | v->ob_digit[i];
+		if ((x >> SHIFT) != prev)
+			return -1;
+	}
+	if (v->ob_neg) {
+		if (x > MAXLONG + 1)
+			return -1;
+		*p_ival = x == 0 ? 0 : -(long)(x-1) - 1;
+	}
+	else {
+		if (x > MAXLONG)
+			return -1;
+		*p_ival = x;
+	}
+	return 0;
+}
+
+long
+getlongvalue(op)
+	object *op;
+{
+	long x;
+	if (is_intobject(op))
+		return getintvalue(op);
+	if (!is_longobject(op)) {
+		err_badcall();
+		return -1;
+	}
+	if (long_aslong((longobject *)op, &x) < 0) {
+		err_setstr(OverflowError, "long int too long to convert");
+		return -1;
+	}
+	return x;
+}
+
+/* Turn the (new) result of a long operation into an object to return:
+   a plain integer if it fits, the normalized long itself otherwise */
+
+static object *
+long_result(v)
+	longobject *v;
+{
+	long x;
+	if (v == NULL)
+		return NULL;
+	long_normalize(v);
+	if (long_aslong(v, &x) < 0)
+		return (object *)v;
+	DECREF(v);
+	return newintobject(x);
+}
+
+/* Convert the right operand of a binary operation to a (new) long */
+
+static longobject *
+tolong(w)
+	object *w;
+{
+	if (is_longobject(w)) {
+		INCREF(w);
+		return (longobject *)w;
+	}
+	if (is_intobject(w))
+		return (longobject *)newlongobject(getintvalue(w));
+	err_badarg();
+	return NULL;
+}
+
+/* Primitives on absolute values.
+   These ignore the signs of their arguments and return new,
+   non-negative longs (or NULL if out of memory). */
+
+static longobject *
+x_add(a, b)
+	longobject *a, *b;
+{
+	int size_a = a->ob_size, size_b = b->ob_size;
+	longobject *z;
+	register int i;
+	register digit carry = 0;
+	if (size_a < size_b) {
+		z = a; a = b; b = z;
+		i = size_a; size_a = size_b; size_b = i;
+	}
+	z = alloclongobject(size_a+1);
+	if (z == NULL)
+		return NULL;
+	for (i = 0; i < size_b; i++) {
+		carry += a->ob_digit[i] + b->ob_digit[i];
+		z->ob_digit[i] = carry & MASK;
+		carry >>= SHIFT;
+	}
+	for (; i < size_a; i++) {
+		carry += a->ob_digit[i];
+		z->ob_digit[i] = carry & MASK;
+		carry >>= SHIFT;
+	}
+	z->ob_digit[i] = carry;
+	return long_normalize(z);
+}
+
+/* |a| - |b|; this one returns a negative result if |a| < |b| */
+
+static longobject *
+x_sub(a, b)
+	longobject *a, *b;
+{
+	int size_a = a->ob_size, size_b = b->ob_size;
+	longobject *z;
+	register int i;
+	register digit borrow = 0;
+	int neg = 0;
+	if (size_a < size_b) {
+		neg = 1;
+		z = a; a = b; b = z;
+		i = size_a; size_a = size_b; size_b = i;
+	}
+	else if (size_a == size_b) {
+		/* Find highest digit where a and b differ */
+		i = size_a;
+		while (--i >= 0 && a->ob_digit[i] == b->ob_digit[i])
+			;
+		if (i < 0)
+			return alloclongobject(0);
+		if (a->ob_digit[i] < b->ob_digit[i]) {
+			neg = 1;
+			z = a; a = b; b = z;
+		}
+		size_a = size_b = i+1;
+	}
+	z = alloclongobject(size_a);
+	if (z == NULL)
+		return NULL;
+	for (i = 0; i < size_b; i++) {
+		/* The following assumes unsigned arithmetic
+		   works modulo 2**N for some N > SHIFT */
+		borrow = a->ob_digit[i] - b->ob_digit[i] - borrow;
+		z->ob_digit[i] = borrow & MASK;
+		borrow >>= SHIFT;
+		borrow &= 1; /* Keep only one sign bit */
+	}
+	for (; i < size_a; i++) {
+		borrow = a->ob_digit[i] - borrow;
+		z->ob_digit[i] = borrow & MASK;
+		borrow >>= SHIFT;
+		borrow &= 1;
+	}
+	z->ob_neg = neg;
+	return long_normalize(z);
+}
+
+/* Multiply by a single digit, adding an extra (small) digit */
+
+static longobject *
+muladd1(a, n, extra)
+	longobject *a;
+	digit n, extra;
+{
+	int size_a = a->ob_size;
+	longobject *z;
+	register twodigits carry = extra;
+	register int i;
+	z = alloclongobject(size_a+1);
+	if (z == NULL)
+		return NULL;
+	for (i = 0; i < size_a; i++) {
+		carry += (twodigits)a->ob_digit[i] * n;
+		z->ob_digit[i] = carry & MASK;
+		carry >>= SHIFT;
+	}
+	z->ob_digit[i] = carry;
+	return long_normalize(z);
+}
+
+/* Schoolbook multiplication */
+
+static longobject *
+x_mul(a, b)
+	longobject *a, *b;
+{
+	int size_a = a->ob_size, size_b = b->ob_size;
+	longobject *z;
+	register digit *pz;
+	register twodigits carry, f;
+	int i, j;
+	z = alloclongobject(size_a + size_b);
+	if (z == NULL)
+		return NULL;
+	for (i = 0; i < size_a + size_b; i++)
+		z->ob_digit[i] = 0;
+	for (i = 0; i < size_a; i++) {
+		f = a->ob_digit[i];
+		if (f == 0)
+			continue;
+		pz = z->ob_digit + i;
+		carry = 0;
+		for (j = 0; j < size_b; j++) {
+			carry += *pz + b->ob_digit[j] * f;
+			*pz++ = carry & MASK;
+			carry >>= SHIFT;
+		}
+		*pz = carry; /* This digit wasn't touched yet */
+	}
+	return long_normalize(z);
+}
+
+/* Split n into high and low parts: n = high * BASE**size + low */
+
+static int
+kmul_split(n, size, p_high, p_low)
+	longobject *n;
+	int size;
+	longobject **p_high, **p_low;
+{
+	longobject *hi, *lo;
+	int size_lo = n->ob_size < size ? n->ob_size : size;
+	int size_hi = n->ob_size - size_lo;
+	if ((hi = alloclongobject(size_hi)) == NULL)
+		return -1;
+	if ((lo = alloclongobject(size_lo)) == NULL) {
+		DECREF(hi);
+		return -1;
+	}
+	memcpy((char *)lo->ob_digit, (char *)n->ob_digit,
+						size_lo * sizeof(digit));
+	memcpy((char *)hi->ob_digit, (char *)(n->ob_digit + size_lo),
+						size_hi * sizeof(digit));
+	*p_high = long_normalize(hi);
+	*p_low = long_normalize(lo);
+	return 0;
+}
+
+/* x[0:m] += y[0:n] and x[0:m] -= y[0:n], for m >= n;
+   return the carry or borrow out of x[m-1] */
+
+static digit
+v_iadd(x, m, y, n)
+	register digit *x;
+	int m;
+	register digit *y;
+	int n;
+{
+	register int i;
+	register digit carry = 0;
+	for (i = 0; i < n; i++) {
+		carry += x[i] + y[i];
+		x[i] = carry & MASK;
+		carry >>= SHIFT;
+	}
+	for (; carry && i < m; i++) {
+		carry += x[i];
+		x[i] = carry & MASK;
+		carry >>= SHIFT;
+	}
+	return carry;
+}
+
+static digit
+v_isub(x, m, y, n)
+	register digit *x;
+	int m;
+	register digit *y;
+	int n;
+{
+	register int i;
+	register digit borrow = 0;
+	for (i = 0; i < n; i++) {
+		borrow = x[i] - y[i] - borrow;
+		x[i] = borrow & MASK;
+		borrow >>= SHIFT;
+		borrow &= 1;
+	}
+	for (; borrow && i < m; i++) {
+		borrow = x[i] - borrow;
+		x[i] = borrow & MASK;
+		borrow >>= SHIFT;
+		borrow &= 1;
+	}
+	return borrow;
+}
+
+static longobject *k_mul PROTO((longobject *, longobject *));
+
+/* Karatsuba works best on operands of similar size; when b is more
+   than twice as long as a, multiply a by a-sized slices of b */
+
+static longobject *
+k_lopsided_mul(a, b)
+	longobject *a, *b;
+{
+	int size_a = a->ob_size, size_b = b->ob_size;
+	int nbdone = 0, nbtouse, i;
+	longobject *ret, *bslice, *product;
+	ret = alloclongobject(size_a + size_b);
+	if (ret == NULL)
+		return NULL;
+	for (i = 0; i < size_a + size_b; i++)
+		ret->ob_digit[i] = 0;
+	bslice = alloclongobject(size_a);
+	if (bslice == NULL) {
+		DECREF(ret);
+		return NULL;
+	}
+	while (size_b > 0) {
+		nbtouse = size_b < size_a ? size_b : size_a;
+		memcpy((char *)bslice->ob_digit, (char *)(b->ob_digit + nbdone),
+						nbtouse * sizeof(digit));
+		bslice->ob_size = nbtouse;
+		product = k_mul(a, long_normalize(bslice));
+		if (product == NULL) {
+			DECREF(ret);
+			ret = NULL;
+			break;
+		}
+		(void) v_iadd(ret->ob_digit + nbdone, ret->ob_size - nbdone,
+				product->ob_digit, (int) product->ob_size);
+		DECREF(product);
+		size_b -= nbtouse;
+		nbdone += nbtouse;
+	}
+	DECREF(bslice);
+	return ret == NULL ? NULL : long_normalize(ret);
+}
+
+/* Karatsuba multiplication: with a = ah*X + al and b = bh*X + bl,
+   a*b = ah*bh*X*X + ((ah+al)*(bh+bl) - ah*bh - al*bl)*X + al*bl,
+   which takes three half-size multiplications instead of four */
+
+static longobject *
+k_mul(a, b)
+	longobject *a, *b;
+{
+	int size_a = a->ob_size, size_b = b->ob_size;
+	longobject *ah = NULL, *al = NULL, *bh = NULL, *bl = NULL;
+	longobject *ret = NULL, *t1 = NULL, *t2 = NULL, *t3 = NULL;
+	int shift, i;
+
+	/* Make a the shorter one */
+	if (size_a > size_b) {
+		t1 = a; a = b; b = t1; t1 = NULL;
+		i = size_a; size_a = size_b; size_b = i;
+	}
+	if (size_a <= KARATSUBA_CUTOFF) {
+		if (size_a == 0)
+			return alloclongobject(0);
+		return x_mul(a, b);
+	}
+	if (2 * size_a <= size_b)
+		return k_lopsided_mul(a, b);
+
+	shift = size_b >> 1;
+	if (kmul_split(a, shift, &ah, &al) < 0)
+		goto fail;
+	if (kmul_split(b, shift, &bh, &bl) < 0)
+		goto fail;
+
+	ret = alloclongobject(size_a + size_b);
+	if (ret == NULL)
+		goto fail;
+
+	/* ret = ah*bh*X*X + al*bl */
+	if ((t1 = k_mul(ah, bh)) == NULL)
+		goto fail;
+	memcpy((char *)(ret->ob_digit + 2*shift), (char *)t1->ob_digit,
+					t1->ob_size * sizeof(digit));
+	for (i = 2*shift + t1->ob_size; i < ret->ob_size; i++)
+		ret->ob_digit[i] = 0;
+	if ((t2 = k_mul(al, bl)) == NULL)
+		goto fail;
+	memcpy((char *)ret->ob_digit, (char *)t2->ob_digit,
+					t2->ob_size * sizeof(digit));
+	for (i = t2->ob_size; i < 2*shift; i++)
+		ret->ob_digit[i] = 0;
+
+	/* Subtract both from the middle; borrows out of the top are
+	   cancelled when the (larger) middle product is added */
+	i = ret->ob_size - shift;
+	(void) v_isub(ret->ob_digit + shift, i, t2->ob_digit, (int) t2->ob_size);
+	(void) v_isub(ret->ob_digit + shift, i, t1->ob_digit, (int) t1->ob_size);
+	DECREF(t1);
+	DECREF(t2);
+	t2 = NULL;
+
+	/* Add (ah+al)*(bh+bl) to the middle */
+	if ((t1 = x_add(ah, al)) == NULL)
+		goto fail;
+	if ((t2 = x_add(bh, bl)) == NULL)
+		goto fail;
+	if ((t3 = k_mul(t1, t2)) == NULL)
+		goto fail;
+	(void) v_iadd(ret->ob_digit + shift, i, t3->ob_digit, (int) t3->ob_size);
+	goto done;
+
+ fail:
+	if (ret != NULL) {
+		DECREF(ret);
+		ret = NULL;
+	}
+ done:
+	if (ah != NULL) {
+		DECREF(ah);
+	}
+	if (al != NULL) {
+		DECREF(al);
+	}
+	if (bh != NULL) {
+		DECREF(bh);
+	}
+	if (bl != NULL) {
+		DECREF(bl);
+	}
+	if (t1 != NULL) {
+		DECREF(t1);
+	}
+	if (t2 != NULL) {
+		DECREF(t2);
+	}
+	if (t3 != NULL) {
+		DECREF(t3);
+	}
+	return ret == NULL ? NULL : long_normalize(ret);
+}
+
+/* Divide by a single digit, returning the remainder in *prem */
+
+static longobject *
+divrem1(a, n, prem)
+	longobject *a;
+	digit n;
+	digit *prem;
+{
+	int size = a->ob_size;
+	longobject *z;
+	register twodigits rem = 0;
+	register int i;
+	z = alloclongobject(size);
+	if (z == NULL)
+		return NULL;
+	for (i = size; --i >= 0; ) {
+		rem = (rem << SHIFT) | a->ob_digit[i];
+		z->ob_digit[i] = rem / n;
+		rem -= z->ob_digit[i] * n;
+	}
+	*prem = rem;
+	return long_normalize(z);
+}
+
+/* Knuth's algorithm D, for divisors of at least two digits.
+   Both operands are normalized (multiplied by d) so the leading digit
+   of the divisor is at least BASE/2, which makes the trial quotient
+   at most 2 too big. */
+
+static longobject *
+x_divrem(v1, w1, prem)
+	longobject *v1, *w1;
+	longobject **prem;
+{
+	int size_v, size_w = w1->ob_size;
+	digit d = (digit) ((twodigits)BASE / (w1->ob_digit[size_w-1] + 1));
+	longobject *v, *w, *a;
+	int i, j, k;
+
+	v = muladd1(v1, d, (digit)0);
+	w = muladd1(w1, d, (digit)0);
+	if (v == NULL || w == NULL) {
+		if (v != NULL) {
+			DECREF(v);
+		}
+		if (w != NULL) {
+			DECREF(w);
+		}
+		return NULL;
+	}
+	size_v = v->ob_size;
+	a = alloclongobject(size_v - size_w + 1);
+
+	for (j = size_v, k = size_v - size_w; a != NULL && k >= 0; --j, --k) {
+		digit vj = (j >= size_v) ? 0 : v->ob_digit[j];
+		twodigits q;
+		stwodigits carry = 0;
+
+		if (vj == w->ob_digit[size_w-1])
+			q = MASK;
+		else
+			q = (((twodigits)vj << SHIFT) + v->ob_digit[j-1]) /
+				w->ob_digit[size_w-1];
+
+		while (w->ob_digit[size_w-2]*q >
+				((
+					((twodigits)vj << SHIFT)
+					+ v->ob_digit[j-1]
+					- q*w->ob_digit[size_w-1]
+								) << SHIFT)
+				+ v->ob_digit[j-2])
+			--q;
+
+		/* Subtract q*w from v[k:k+size_w] */
+		for (i = 0; i < size_w && i+k < size_v; i++) {
+			twodigits z = w->ob_digit[i] * q;
+			digit zz = (digit) (z >> SHIFT);
+			carry += (stwodigits)v->ob_digit[i+k] -
+						(stwodigits)(z & MASK);
+			v->ob_digit[i+k] = carry & MASK;
+			carry >>= SHIFT; /* Assumes arithmetic shift */
+			carry -= zz;
+		}
+		if (i+k < size_v) {
+			carry += v->ob_digit[i+k];
+			v->ob_digit[i+k] = 0;
+		}
+
+		if (carry == 0)
+			a->ob_digit[k] = q;
+		else {
+			/* q was one too big; add w back */
+			a->ob_digit[k] = q-1;
+			carry = 0;
+			for (i = 0; i < size_w && i+k < size_v; i++) {
+				carry += v->ob_digit[i+k] + w->ob_digit[i];
+				v->ob_digit[i+k] = carry & MASK;
+				carry >>= SHIFT;
+			}
+		}
+	}
+
+	if (a != NULL) {
+		a = long_normalize(a);
+		/* Unnormalize the remainder; d receives the zero remainder */
+		*prem = divrem1(long_normalize(v), d, &d);
+		if (*prem == NULL) {
+			DECREF(a);
+			a = NULL;
+		}
+	}
+	DECREF(v);
+	DECREF(w);
+	return a;
+}
+
+/* Division with remainder, truncating towards zero like the plain
+   integer operations: the remainder has the sign of a */
+
+static int
+long_divrem(a, b, pdiv, prem)
+	longobject *a, *b;
+	longobject **pdiv, **prem;
+{
+	int size_a = a->ob_size, size_b = b->ob_size;
+	longobject *z;
+
+	if (size_b == 0) {
+		err_setstr(ZeroDivisionError, "long division by zero");
+		return -1;
+	}
+	if (size_a < size_b || (size_a == size_b &&
+			a->ob_digit[size_a-1] < b->ob_digit[size_b-1])) {
+		/* |a| < |b| */
+		if ((*pdiv = alloclongobject(0)) == NULL)
+			return -1;
+		INCREF(a);
+		*prem = a;
+		return 0;
+	}
+	if (size_b == 1) {
+		digit rem = 0;
+		z = divrem1(a, b->ob_digit[0], &rem);
+		if (z == NULL)
+			return -1;
+		*prem = (longobject *) newlongobject((long)rem);
+		if (*prem == NULL) {
+			DECREF(z);
+			return -1;
+		}
+	}
+	else {
+		z = x_divrem(a, b, prem);
+		if (z == NULL)
+			return -1;
+	}
+	if (a->ob_neg != b->ob_neg && z->ob_size != 0)
+		z->ob_neg = 1;
+	if (a->ob_neg && (*prem)->ob_size != 0)
+		(*prem)->ob_neg = 1;
+	*pdiv = z;
+	return 0;
+}
+
+/* Decimal conversion.  The absolute value is first converted to base
+   10000 in a single pass over its digits (10000 is the largest power
+   of 10 below BASE), then written out four decimal digits at a time. */
+
+#define DECBASE 10000
+
+static object *
+long_format(a)
+	longobject *a;
+{
+	int size_a = a->ob_size;
+	int size, i, j, len;
+	digit *pout;
+	register twodigits hi, z;
+	object *str;
+	register char *p;
+
+	/* log(BASE)/log(DECBASE) = 1.13 < 1 + 1/7 */
+	pout = NEW(digit, 1 + size_a + size_a/7);
+	if (pout == NULL)
+		return err_nomem();
+	size = 0;
+	for (i = size_a; --i >= 0; ) {
+		hi = a->ob_digit[i];
+		for (j = 0; j < size; j++) {
+			z = ((twodigits)pout[j] << SHIFT) | hi;
+			hi = z / DECBASE;
+			pout[j] = z - hi * DECBASE;
+		}
+		while (hi != 0) {
+			pout[size++] = hi % DECBASE;
+			hi /= DECBASE;
+		}
+	}
+	if (size == 0)
+		pout[size++] = 0;
+
+	/* Four characters per base 10000 digit, fewer for the top one */
+	len = a->ob_neg + 4*(size-1);
+	for (hi = pout[size-1]; ; hi /= 10) {
+		len++;
+		if (hi < 10)
+			break;
+	}
+	str = newsizedstringobject((char *)NULL, len);
+	if (str == NULL) {
+		DEL(pout);
+		return NULL;
+	}
+	p = getstringvalue(str) + len;
+	for (i = 0; i < size-1; i++) {
+		hi = pout[i];
+		for (j = 0; j < 4; j++) {
+			*--p = '0' + hi % 10;
+			hi /= 10;
+		}
+	}
+	hi = pout[size-1];
+	do {
+		*--p = '0' + hi % 10;
+		hi /= 10;
+	} while (hi != 0);
+	if (a->ob_neg)
+		*--p = '-';
+	DEL(pout);
+	return str;
+}
+
+/* Value of a digit in bases up to 16, or 16 if c isn't one */
+
+static int
+digitvalue(c)
+	int c;
+{
+	if (c >= '0' && c <= '9')
+		return c - '0';
+	if (c >= 'a' && c <= 'f')
+		return c - 'a' + 10;
+	if (c >= 'A' && c <= 'F')
+		return c - 'A' + 10;
+	return 16;
+}
+
+/* Convert a string of digits in base 8, 10 or 16, with optional sign
+   and without a base prefix, to a long (or a plain integer if it is
+   small enough).  Several digits are processed per pass over the
+   partial result.  If pend is not NULL, *pend is set to point after
+   the last digit. */
+
+object *
+long_scan(str, pend, base)
+	char *str;
+	char **pend;
+	int base;
+{
+	register char *p;
+	int neg = 0, n, i, k, per;
+	longobject *z;
+	register twodigits carry, m;
+
+	if (base != 8 && base != 10 && base != 16) {
+		err_badcall();
+		return NULL;
+	}
+	if (*str == '-' || *str == '+')
+		neg = (*str++ == '-');
+	for (p = str; digitvalue(*p) < base; p++)
+		;
+	if (pend != NULL)
+		*pend = p;
+	n = p - str;
+	if (n == 0) {
+		err_setstr(RuntimeError, "no digits in long int constant");
+		return NULL;
+	}
+	/* Digits per pass, such that base**per < BASE; then also
+	   log(base)/log(BASE) < 1/per */
+	per = base == 16 ? 3 : 4;
+	z = alloclongobject(n/per + 1);
+	if (z == NULL)
+		return NULL;
+	z->ob_size = 0;
+	for (p = str; n > 0; n -= k) {
+		/* z = z * base**k + (next k digits) */
+		k = n % per == 0 ? per : n % per;
+		carry = 0;
+		m = 1;
+		for (i = 0; i < k; i++) {
+			carry = carry*base + digitvalue(*p++);
+			m *= base;
+		}
+		for (i = 0; i < z->ob_size; i++) {
+			carry += (twodigits)z->ob_digit[i] * m;
+			z->ob_digit[i] = carry & MASK;
+			carry >>= SHIFT;
+		}
+		if (carry != 0)
+			z->ob_digit[z->ob_size++] = carry;
+	}
+	z->ob_neg = neg;
+	return long_result(z);
+}
+
+/* Methods */
+
+static void
+long_print(v, fp, flags)
+	longobject *v;
+	FILE *fp;
+	int flags;
+{
+	object *str = long_format(v);
+	if (str == NULL) {
+		err_clear();
+		fprintf(fp, "<long int>");
+		return;
+	}
+	fputs(getstringvalue(str), fp);
+	DECREF(str);
+}
+
+static object *
+long_repr(v)
+	longobject *v;
+{
+	return long_format(v);
+}
+
+static int
+long_compare(a, b)
+	longobject *a, *b;
+{
+	int sign, i;
+	if (a->ob_neg != b->ob_neg)
+		return a->ob_neg ? -1 : 1;
+	if (a->ob_size != b->ob_size)
+		sign = a->ob_size < b->ob_size ? -1 : 1;
+	else {
+		i = a->ob_size;
+		while (--i >= 0 && a->ob_digit[i] == b->ob_digit[i])
+			;
+		if (i < 0)
+			return 0;
+		sign = a->ob_digit[i] < b->ob_digit[i] ? -1 : 1;
+	}
+	return a->ob_neg ? -sign : sign;
+}
+
+static object *
+long_add(a, w)
+	longobject *a;
+	object *w;
+{
+	longobject *b, *z;
+	if ((b = tolong(w)) == NULL)
+		return NULL;
+	if (a->ob_neg == b->ob_neg) {
+		z = x_add(a, b);
+		if (z != NULL && z->ob_size != 0)
+			z->ob_neg = a->ob_neg;
+	}
+	else if (a->ob_neg)
+		z = x_sub(b, a);
+	else
+		z = x_sub(a, b);
+	DECREF(b);
+	return long_result(z);
+}
+
+static object *
+long_sub(a, w)
+	longobject *a;
+	object *w;
+{
+	longobject *b, *z;
+	if ((b = tolong(w)) == NULL)
+		return NULL;
+	if (a->ob_neg != b->ob_neg) {
+		z = x_add(a, b);
+		if (z != NULL && z->ob_size != 0)
+			z->ob_neg = a->ob_neg;
+	}
+	else if (a->ob_neg)
+		z = x_sub(b, a);
+	else
+		z = x_sub(a, b);
+	DECREF(b);
+	return long_result(z);
+}
+
+static object *
+long_mul(a, w)
+	longobject *a;
+	object *w;
+{
+	longobject *b, *z;
+	if ((b = tolong(w)) == NULL)
+		return NULL;
+	z = k_mul(a, b);
+	if (z != NULL && z->ob_size != 0)
+		z->ob_neg = a->ob_neg != b->ob_neg;
+	DECREF(b);
+	return long_result(z);
+}
+
+static object *
+long_div(a, w)
+	longobject *a;
+	object *w;
+{
+	longobject *b, *div, *rem;
+	int err;
+	if ((b = tolong(w)) == NULL)
+		return NULL;
+	err = long_divrem(a, b, &div, &rem);
+	DECREF(b);
+	if (err < 0)
+		return NULL;
+	DECREF(rem);
+	return long_result(div);
+}
+
+static object *
+long_rem(a, w)
+	longobject *a;
+	object *w;
+{
+	longobject *b, *div, *rem;
+	int err;
+	if ((b = tolong(w)) == NULL)
+		return NULL;
+	err = long_divrem(a, b, &div, &rem);
+	DECREF(b);
+	if (err < 0)
+		return NULL;
+	DECREF(div);
+	return long_result(rem);
+}
+
+/* Exponentiation by repeated squaring, scanning the exponent's bits
+   from the top; negative exponents truncate like plain integers */
+
+static object *
+long_pow(a, w)
+	longobject *a;
+	object *w;
+{
+	longobject *b, *z, *t;
+	register digit bi;
+	int i, j, odd;
+	if ((b = tolong(w)) == NULL)
+		return NULL;
+	odd = b->ob_size != 0 && (b->ob_digit[0] & 1);
+	if (b->ob_neg) {
+		i = b->ob_digit[0] & 1;
+		DECREF(b);
+		if (a->ob_size == 0) {
+			err_setstr(ZeroDivisionError, "long division by zero");
+			return NULL;
+		}
+		if (a->ob_size == 1 && a->ob_digit[0] == 1)
+			return newintobject(a->ob_neg && i ? -1L : 1L);
+		return newintobject(0L);
+	}
+	z = (longobject *) newlongobject(1L);
+	for (i = b->ob_size; z != NULL && --i >= 0; ) {
+		bi = b->ob_digit[i];
+		for (j = SHIFT; z != NULL && --j >= 0; ) {
+			t = k_mul(z, z);
+			DECREF(z);
+			z = t;
+			if (z != NULL && (bi >> j) & 1) {
+				t = k_mul(z, a);
+				DECREF(z);
+				z = t;
+			}
+		}
+	}
+	if (z != NULL && z->ob_size != 0)
+		z->ob_neg = a->ob_neg && odd;
+	DECREF(b);
+	return long_result(z);
+}
+
+static object *
+long_neg(v)
+	longobject *v;
+{
+	longobject *z = alloclongobject((int) v->ob_size);
+	if (z == NULL)
+		return NULL;
+	memcpy((char *)z->ob_digit, (char *)v->ob_digit,
+					v->ob_size * sizeof(digit));
+	z->ob_neg = !v->ob_neg;
+	return long_result(z);
+}
+
+static object *
+long_pos(v)
+	longobject *v;
+{
+	INCREF(v);
+	return (object *)v;
+}
+
+static number_methods long_as_number = {
+	long_add,	/*nb_add*/
+	long_sub,	/*nb_subtract*/
+	long_mul,	/*nb_multiply*/
+	long_div,	/*nb_divide*/
+	long_rem,	/*nb_remainder*/
+	long_pow,	/*nb_power*/
+	long_neg,	/*nb_negative*/
+	long_pos,	/*nb_positive*/
+};
+
+typeobject Longtype = {
+	OB_HEAD_INIT(&Typetype)
+	0,
+	"long int",
+	sizeof(longobject) - sizeof(digit),
+	sizeof(digit),
+	free,		/*tp_dealloc*/
+	long_print,	/*tp_print*/
+	0,		/*tp_getattr*/
+	0,		/*tp_setattr*/
+	long_compare,	/*tp_compare*/
+	long_repr,	/*tp_repr*/
+	&long_as_number,/*tp_as_number*/
+	0,		/*tp_as_sequence*/
+	0,		/*tp_as_mapping*/
+};
@@ -16,6 +16,7 @@ typedef struct {
 	char *m_name;
 	method m_meth;
 	object *m_self;
+	int m_flags;
 } methodobject;
 
 object *
@@ -23,6 +24,16 @@ newmethodobject(name, meth, self)
 	char *name; /* static string */
 	method meth;
 	object *self;
+{
+	return newflagmethodobject(name, meth, self, 0);
+}
+
+object *
+newflagmethodobject(name, meth, self, flags)
+	char *name; /* static string */
+	method meth;
+	object *self;
+	int flags; /* METH_ARRAY or 0 */
 {
 	methodobject *op = NEWOBJ(methodobject, &Methodtype);
 	if (op != NULL) {
@@ -31,6 +42,7 @@ newmethodobject(name, meth, self)
 		if (self != NULL)
 			INCREF(self);
 		op->m_self = self;
+		op->m_flags = flags;
 	}
 	return (object *)op;
 }
@@ -57,6 +69,17 @@ getself(op)
 	return ((methodobject *)op) -> m_self;
 }
 
+int
+getmethodflags(op)
+	object *op;
+{
+	if (!is_methodobject(op)) {
+		err_badcall();
+		return -1;
+	}
+	return ((methodobject *)op) -> m_flags;
+}
+
 /* Methods (the standard built-in methods, that is) */
 
 static void
@@ -14,6 +14,7 @@ typedef struct {
 	OB_HEAD
 	object *md_name;
 	object *md_dict;
+	int md_lazy;		/* Imported lazily and not loaded yet */
 } moduleobject;
 
 object *
@@ -25,6 +26,7 @@ newmoduleobject(name)
 		return NULL;
 	m->md_name = newstringobject(name);
 	m->md_dict = newdictobject();
+	m->md_lazy = 0;
 	if (m->md_name == NULL || m->md_dict == NULL) {
 		DECREF(m);
 		return NULL;
@@ -73,6 +75,30 @@ getmodulename(m)
 	return getstringvalue(((moduleobject *)m) -> md_name);
 }
 
+int
+getmodulelazy(m)
+	object *m;
+{
+	if (!is_moduleobject(m)) {
+		err_badarg();
+		return -1;
+	}
+	return ((moduleobject *)m) -> md_lazy;
+}
+
+int
+setmodulelazy(m, lazy)
+	object *m;
+	int lazy;
+{
+	if (!is_moduleobject(m)) {
+		err_badarg();
+		return -1;
+	}
+	((moduleobject *)m) -> md_lazy = lazy;
+	return 0;
+}
+
 /* Methods */
 
 static void
@@ -1,9 +1,12 @@
 /* Object implementation; and 'noobject' implementation */
 
 #include <stdio.h>
+#include "string.h"
 
 #include "PROTO.h"
 #include "object.h"
+#include "intobject.h"
+#include "longobject.h"
 #include "stringobject.h"
 #include "objimpl.h"
 #include "errors.h"
@@ -117,8 +120,22 @@ cmpobject(v, w)
 		return -1;
 	if (w == NULL)
 		return 1;
-	if ((tp = v->ob_type) != w->ob_type)
+	if ((tp = v->ob_type) != w->ob_type) {
+		/* Plain and long integers compare by value */
+		if (is_intobject(v) && is_longobject(w))
+			return -cmpobject(w, v);
+		if (is_longobject(v) && is_intobject(w)) {
+			int cmp;
+			if ((w = newlongobject(getintvalue(w))) == NULL) {
+				err_clear();
+				return 1;
+			}
+			cmp = (*tp->tp_compare)(v, w);
+			DECREF(w);
+			return cmp;
+		}
 		return strcmp(tp->tp_name, w->ob_type->tp_name);
+	}
 	if (tp->tp_compare == NULL)
 		return (v < w) ? -1 : 1;
 	return ((*tp->tp_compare)(v, w));
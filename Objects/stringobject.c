@@ -1,11 +1,14 @@
 /* String object implementation */
 
 #include <stdio.h>
+#include <string.h>
 
 #include "PROTO.h"
 #include "object.h"
 #include "stringobject.h"
 #include "intobject.h"
+#include "floatobject.h"
+#include "tupleobject.h"
 #include "objimpl.h"
 #include "errors.h"
 
@@ -244,6 +247,420 @@ stringcompare(a, b)
 	return strcmp(a->ob_sval, b->ob_sval);
 }
 
+/* String formatting: format % args.
+   The format is scanned twice: the first pass checks the arguments and
+   computes an upper bound for the size of the result, the second pass
+   writes into a string of that size, which is then trimmed.  Strings
+   made for %s conversions of non-string arguments are saved between the
+   passes so repr() is only called once per argument. */
+
+#define F_LJUST 01
+#define F_SIGN	02
+#define F_BLANK	04
+#define F_ALT	010
+#define F_ZERO	020
+
+#define MAXPREC 100	/* Largest precision allowed for numbers */
+#define MAXSIZE ((int)(~(unsigned int)0 >> 1)) /* Largest result size */
+
+struct fmtspec {
+	int fs_flags;
+	int fs_width;	/* -1 if not specified */
+	int fs_prec;	/* -1 if not specified */
+	int fs_conv;	/* Conversion character */
+	int fs_argidx;	/* Index of the converted argument */
+	object *fs_arg;	/* The argument itself (borrowed) */
+};
+
+static object *
+getnextarg(args, nargs, p_argidx)
+	object *args;
+	int nargs;
+	int *p_argidx;
+{
+	int argidx = *p_argidx;
+	if (argidx >= nargs) {
+		err_setstr(TypeError, "not enough arguments for format string");
+		return NULL;
+	}
+	*p_argidx = argidx + 1;
+	if (is_tupleobject(args))
+		return gettupleitem(args, argidx);
+	return args;
+}
+
+static int
+getstarint(args, nargs, p_argidx, p_val)
+	object *args;
+	int nargs;
+	int *p_argidx;
+	int *p_val;
+{
+	object *v = getnextarg(args, nargs, p_argidx);
+	if (v == NULL)
+		return -1;
+	if (!is_intobject(v)) {
+		err_setstr(TypeError, "* wants int");
+		return -1;
+	}
+	if (getintvalue(v) < 0) {
+		err_setstr(TypeError, "negative width or precision in format");
+		return -1;
+	}
+	if (getintvalue(v) > MAXSIZE) {
+		err_setstr(OverflowError, "width or precision too large");
+		return -1;
+	}
+	*p_val = getintvalue(v);
+	return 0;
+}
+
+/* Parse a width or precision starting at fmt; return a pointer past
+   its last digit, or NULL if it is too large */
+
+static char *
+getdecint(fmt, p_val)
+	register char *fmt;
+	int *p_val;
+{
+	register int val = 0;
+	while (*fmt >= '0' && *fmt <= '9') {
+		if (val > (MAXSIZE - (*fmt - '0')) / 10) {
+			err_setstr(OverflowError, "width or precision too large");
+			return NULL;
+		}
+		val = val*10 + (*fmt++ - '0');
+	}
+	*p_val = val;
+	return fmt;
+}
+
+/* Parse one conversion specification; *p_fmt points just past the '%'
+   and is advanced past the conversion character */
+
+static int
+getfmtspec(p_fmt, fs, args, nargs, p_argidx)
+	char **p_fmt;
+	struct fmtspec *fs;
+	object *args;
+	int nargs;
+	int *p_argidx;
+{
+	register char *fmt = *p_fmt;
+	register int c;
+	fs->fs_flags = 0;
+	fs->fs_width = -1;
+	fs->fs_prec = -1;
+	fs->fs_arg = NULL;
+	fs->fs_argidx = -1;
+	for (;;) {
+		switch (c = *fmt++) {
+		case '-': fs->fs_flags |= F_LJUST; continue;
+		case '+': fs->fs_flags |= F_SIGN; continue;
+		case ' ': fs->fs_flags |= F_BLANK; continue;
+		case '#': fs->fs_flags |= F_ALT; continue;
+		case '0': fs->fs_flags |= F_ZERO; continue;
+		}
+		break;
+	}
+	if (c == '*') {
+		if (getstarint(args, nargs, p_argidx, &fs->fs_width) < 0)
+			return -1;
+		c = *fmt++;
+	}
+	else if (c >= '0' && c <= '9') {
+		if ((fmt = getdecint(fmt-1, &fs->fs_width)) == NULL)
+			return -1;
+		c = *fmt++;
+	}
+	if (c == '.') {
+		c = *fmt++;
+		if (c == '*') {
+			if (getstarint(args, nargs, p_argidx,
+							&fs->fs_prec) < 0)
+				return -1;
+			c = *fmt++;
+		}
+		else {
+			if ((fmt = getdecint(fmt-1, &fs->fs_prec)) == NULL)
+				return -1;
+			c = *fmt++;
+		}
+	}
+	*p_fmt = fmt;
+	fs->fs_conv = c;
+	switch (c) {
+	case '%':
+		return 0;
+	case 's':
+	case 'c':
+	case 'd': case 'i': case 'o': case 'x': case 'X':
+	case 'e': case 'E': case 'f': case 'g': case 'G':
+		break;
+	case '\0':
+		*p_fmt = fmt-1;
+		err_setstr(TypeError, "incomplete format");
+		return -1;
+	default:
+		err_setstr(TypeError, "unsupported format character");
+		return -1;
+	}
+	fs->fs_argidx = *p_argidx;
+	fs->fs_arg = getnextarg(args, nargs, p_argidx);
+	if (fs->fs_arg == NULL)
+		return -1;
+	return 0;
+}
+
+/* Build a printf format for a numeric conversion from the spec */
+
+static void
+makecformat(buf, fs, lmod)
+	char *buf;
+	struct fmtspec *fs;
+	char *lmod;
+{
+	register char *p = buf;
+	*p++ = '%';
+	if (fs->fs_flags & F_LJUST) *p++ = '-';
+	if (fs->fs_flags & F_SIGN) *p++ = '+';
+	if (fs->fs_flags & F_BLANK) *p++ = ' ';
+	if (fs->fs_flags & F_ALT) *p++ = '#';
+	if (fs->fs_flags & F_ZERO) *p++ = '0';
+	*p++ = '*';
+	if (fs->fs_prec >= 0) {
+		*p++ = '.';
+		*p++ = '*';
+	}
+	while (*lmod != '\0')
+		*p++ = *lmod++;
+	*p++ = fs->fs_conv;
+	*p = '\0';
+}
+
+static object *
+stringformat(a, args)
+	stringobject *a;
+	object *args;
+{
+	struct fmtspec fs;
+	object **strs = NULL;
+	object *result = NULL;
+	object *v;
+	char *fmt, *p;
+	char cfmt[20];
+	int nargs, argidx, i;
+	int size, n;
+	
+	if (args == NULL) {
+		err_setstr(TypeError, "format requires arguments");
+		return NULL;
+	}
+	if (is_tupleobject(args))
+		nargs = gettuplesize(args);
+	else
+		nargs = 1;
+	if (nargs > 0) {
+		strs = NEW(object *, nargs);
+		if (strs == NULL)
+			return err_nomem();
+		for (i = 0; i < nargs; i++)
+			strs[i] = NULL;
+	}
+	
+	/* Pass 1: check arguments and compute the size of the result */
+	size = 0;
+	argidx = 0;
+	for (fmt = a->ob_sval; *fmt != '\0'; ) {
+		if (*fmt++ != '%') {
+			size++;
+			continue;
+		}
+		if (getfmtspec(&fmt, &fs, args, nargs, &argidx) < 0)
+			goto error;
+		v = fs.fs_arg;
+		switch (fs.fs_conv) {
+		case '%':
+			n = 1;
+			break;
+		case 's':
+			if (strs[fs.fs_argidx] == NULL) {
+				if (is_stringobject(v)) {
+					INCREF(v);
+				}
+				else {
+					v = reprobject(v);
+					if (v == NULL)
+						goto error;
+				}
+				strs[fs.fs_argidx] = v;
+			}
+			n = getstringsize(strs[fs.fs_argidx]);
+			if (fs.fs_prec >= 0 && fs.fs_prec < n)
+				n = fs.fs_prec;
+			break;
+		case 'c':
+			if (!is_intobject(v) && !(is_stringobject(v) &&
+						getstringsize(v) == 1)) {
+				err_setstr(TypeError,
+					"%c requires int or single char");
+				goto error;
+			}
+			n = 1;
+			break;
+		case 'd': case 'i': case 'o': case 'x': case 'X':
+			if (!is_intobject(v)) {
+				err_setstr(TypeError, "integer argument expected");
+				goto error;
+			}
+			if (fs.fs_prec > MAXPREC) {
+				err_setstr(TypeError, "formatting precision too large");
+				goto error;
+			}
+			/* Octal digits of a long, sign and prefix */
+			n = 3*sizeof(long) + 3;
+			if (fs.fs_prec > 0)
+				n += fs.fs_prec;
+			break;
+		default: /* e E f g G */
+			if (!is_floatobject(v) && !is_intobject(v)) {
+				err_setstr(TypeError, "float argument expected");
+				goto error;
+			}
+			if (fs.fs_prec > MAXPREC) {
+				err_setstr(TypeError, "formatting precision too large");
+				goto error;
+			}
+			n = (fs.fs_prec < 0 ? 6 : fs.fs_prec) + 10;
+			if (fs.fs_conv == 'f') {
+				/* %f prints all integral digits */
+				double x;
+				if (is_floatobject(v))
+					x = getfloatvalue(v);
+				else
+					x = getintvalue(v);
+				if (x < 0)
+					x = -x;
+				n += x < 1e50 ? 50 : 310;
+			}
+			break;
+		}
+		if (fs.fs_width > n)
+			n = fs.fs_width;
+		if (n > MAXSIZE - size) {
+			err_setstr(OverflowError, "formatted string too large");
+			goto error;
+		}
+		size += n;
+	}
+	if (argidx < nargs) {
+		err_setstr(TypeError, "not all arguments converted");
+		goto error;
+	}
+	
+	result = newsizedstringobject((char *)NULL, (int) size);
+	if (result == NULL)
+		goto error;
+	
+	/* Pass 2: produce the output (the arguments are known to be OK) */
+	p = ((stringobject *)result)->ob_sval;
+	argidx = 0;
+	for (fmt = a->ob_sval; *fmt != '\0'; ) {
+		if (*fmt != '%') {
+			*p++ = *fmt++;
+			continue;
+		}
+		fmt++;
+		(void) getfmtspec(&fmt, &fs, args, nargs, &argidx);
+		v = fs.fs_arg;
+		switch (fs.fs_conv) {
+		case '%':
+			*p++ = '%';
+			break;
+		case 's':
+		case 'c':
+			if (fs.fs_conv == 's') {
+				v = strs[fs.fs_argidx];
+				n = getstringsize(v);
+				if (fs.fs_prec >= 0 && fs.fs_prec < n)
+					n = fs.fs_prec;
+			}
+			else
+				n = 1;
+			if (!(fs.fs_flags & F_LJUST))
+				while (fs.fs_width > n) {
+					*p++ = ' ';
+					fs.fs_width--;
+				}
+			if (fs.fs_conv == 's')
+				memcpy(p, getstringvalue(v), (int) n);
+			else if (is_intobject(v))
+				*p = getintvalue(v);
+			else
+				*p = getstringvalue(v)[0];
+			p += n;
+			while (fs.fs_width > n) {
+				*p++ = ' ';
+				fs.fs_width--;
+			}
+			break;
+		case 'd': case 'i': case 'o': case 'x': case 'X':
+			makecformat(cfmt, &fs, "l");
+			if (fs.fs_prec >= 0)
+				sprintf(p, cfmt, fs.fs_width < 0 ? 0 : fs.fs_width,
+					fs.fs_prec, getintvalue(v));
+			else
+				sprintf(p, cfmt, fs.fs_width < 0 ? 0 : fs.fs_width,
+					getintvalue(v));
+			while (*p != '\0')
+				p++;
+			break;
+		default:
+			{
+				double x;
+				if (is_floatobject(v))
+					x = getfloatvalue(v);
+				else
+					x = getintvalue(v);
+				makecformat(cfmt, &fs, "");
+				if (fs.fs_prec >= 0)
+					sprintf(p, cfmt,
+						fs.fs_width < 0 ? 0 : fs.fs_width,
+						fs.fs_prec, x);
+				else
+					sprintf(p, cfmt,
+						fs.fs_width < 0 ? 0 : fs.fs_width, x);
+				while (*p != '\0')
+					p++;
+			}
+			break;
+		}
+	}
+	*p = '\0';
+	resizestring(&result, (int) (p - ((stringobject *)result)->ob_sval));
+	
+ error:
+	if (strs != NULL) {
+		for (i = 0; i < nargs; i++) {
+			if (strs[i] != NULL)
+				DECREF(strs[i]);
+		}
+		DEL(strs);
+	}
+	return result;
+}
+
+static number_methods string_as_number = {
+	0,		/*nb_add*/
+	0,		/*nb_subtract*/
+	0,		/*nb_multiply*/
+	0,		/*nb_divide*/
+	stringformat,	/*nb_remainder*/
+	0,		/*nb_power*/
+	0,		/*nb_negative*/
+	0,		/*nb_positive*/
+};
+
 static sequence_methods string_as_sequence = {
 	stringlength,	/*tp_length*/
 	stringconcat,	/*tp_concat*/
@@ -266,7 +683,7 @@ typeobject Stringtype = {
 	0,		/*tp_setattr*/
 	stringcompare,	/*tp_compare*/
 	stringrepr,	/*tp_repr*/
-	0,		/*tp_as_number*/
+	&string_as_number,	/*tp_as_number*/
 	&string_as_sequence,	/*tp_as_sequence*/
 	0,		/*tp_as_mapping*/
 };
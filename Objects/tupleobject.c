@@ -65,6 +65,17 @@ gettupleitem(op, i)
 	return ((tupleobject *)op) -> ob_item[i];
 }
 
+object **
+gettupleitems(op)
+	register object *op;
+{
+	if (!is_tupleobject(op)) {
+		err_badcall();
+		return NULL;
+	}
+	return ((tupleobject *)op) -> ob_item;
+}
+
 int
 settupleitem(op, i, newitem)
 	register object *op;
@@ -1,5 +1,14 @@
 /* Parser accelerator module */
 
+/* For each state, the accelerator maps a label (between s_lower and
+   s_upper) to what the parser must do with a token of that label:
+   -1 if it is a syntax error, the next state if the token is shifted,
+   or, with bit 7 set, the next state in the low 7 bits and in the high
+   byte the non-terminal to push.  This fits in a short.
+
+   pgen computes the accelerators and writes them to graminit.c; the
+   parser only adds them at run time for grammars that lack them. */
+
 #include <stdio.h>
 
 #include "PROTO.h"
@@ -15,10 +24,10 @@ fixstate(g, d, s)
 {
 	arc *a;
 	int k;
-	int *accel;
+	short *accel;
 	int nl = g->g_ll.ll_nlabels;
 	s->s_accept = 0;
-	accel = NEW(int, nl);
+	accel = NEW(short, nl);
 	for (k = 0; k < nl; k++)
 		accel[k] = -1;
 	a = s->s_arc;
@@ -57,15 +66,16 @@ fixstate(g, d, s)
 		k++;
 	if (k < nl) {
 		int i;
-		s->s_accel = NEW(int, nl-k);
-		if (s->s_accel == NULL) {
+		short *sa = NEW(short, nl-k);
+		if (sa == NULL) {
 			fprintf(stderr, "no mem to add parser accelerators\n");
 			exit(1);
 		}
 		s->s_lower = k;
 		s->s_upper = nl;
 		for (i = 0; k < nl; i++, k++)
-			s->s_accel[i] = accel[k];
+			sa[i] = accel[k];
+		s->s_accel = sa;
 	}
 	DEL(accel);
 }
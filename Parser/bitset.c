@@ -8,16 +8,16 @@ bitset
 newbitset(nbits)
 	int nbits;
 {
-	int nbytes = NBYTES(nbits);
-	bitset ss = NEW(BYTE, nbytes);
+	int nwords = NWORDS(nbits);
+	WORD *ws = NEW(WORD, nwords);
 	
-	if (ss == NULL)
+	if (ws == NULL)
 		fatal("no mem for bitset");
 	
-	ss += nbytes;
-	while (--nbytes >= 0)
-		*--ss = 0;
-	return ss;
+	ws += nwords;
+	while (--nwords >= 0)
+		*--ws = 0;
+	return (bitset)ws;
 }
 
 void
@@ -56,10 +56,11 @@ samebitset(ss1, ss2, nbits)
 	bitset ss1, ss2;
 	int nbits;
 {
-	int i;
+	register WORD *ws1 = (WORD *)ss1, *ws2 = (WORD *)ss2;
+	register int i;
 	
-	for (i = NBYTES(nbits); --i >= 0; )
-		if (*ss1++ != *ss2++)
+	for (i = NWORDS(nbits); --i >= 0; )
+		if (*ws1++ != *ws2++)
 			return 0;
 	return 1;
 }
@@ -69,8 +70,62 @@ mergebitset(ss1, ss2, nbits)
 	bitset ss1, ss2;
 	int nbits;
 {
-	int i;
+	register WORD *ws1 = (WORD *)ss1, *ws2 = (WORD *)ss2;
+	register int i;
 	
-	for (i = NBYTES(nbits); --i >= 0; )
-		*ss1++ |= *ss2++;
+	for (i = NWORDS(nbits); --i >= 0; )
+		*ws1++ |= *ws2++;
+}
+
+unsigned long
+hashbitset(ss, nbits)
+	bitset ss;
+	int nbits;
+{
+	register WORD *ws = (WORD *)ss;
+	register unsigned long h = 0;
+	register int i;
+	
+	for (i = NWORDS(nbits); --i >= 0; )
+		h = h * 1000003 ^ *ws++;
+	return h;
+}
+
+/* Count the bits that are set; each step clears the lowest one */
+
+int
+countbits(ss, nbits)
+	bitset ss;
+	int nbits;
+{
+	register WORD *ws = (WORD *)ss;
+	register WORD w;
+	register int i, n = 0;
+	
+	for (i = NWORDS(nbits); --i >= 0; ) {
+		for (w = *ws++; w != 0; w &= w - 1)
+			n++;
+	}
+	return n;
+}
+
+/* Return the first bit set at or after ibit, skipping empty words */
+
+int
+nextbit(ss, ibit, nbits)
+	bitset ss;
+	int ibit;
+	int nbits;
+{
+	WORD *ws = (WORD *)ss;
+	
+	while (ibit < nbits) {
+		if (ws[ibit / BITSPERWORD] == 0)
+			ibit = (ibit / BITSPERWORD + 1) * BITSPERWORD;
+		else if (testbit(ss, ibit))
+			return ibit;
+		else
+			ibit++;
+	}
+	return -1;
 }
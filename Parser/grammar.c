@@ -23,6 +23,12 @@ newgrammar(start)
 	g->g_ndfas = 0;
 	g->g_dfa = NULL;
 	g->g_start = start;
+	g->g_accel = 0;
+	g->g_compact = 0;
+	g->g_kwsize = 0;
+	g->g_kwlabel = NULL;
+	g->g_toklabel = NULL;
+	g->g_parse = NULL;
 	g->g_ll.ll_nlabels = 0;
 	g->g_ll.ll_label = NULL;
 	return g;
@@ -61,6 +67,10 @@ addstate(d)
 	s = &d->d_state[d->d_nstates++];
 	s->s_narcs = 0;
 	s->s_arc = NULL;
+	s->s_lower = 0;
+	s->s_upper = 0;
+	s->s_accel = NULL;
+	s->s_accept = 0;
 	return s - d->d_state;
 }
 
@@ -50,3 +50,19 @@ labelrepr(lb)
 		}
 	}
 }
+
+/* Hash function for keyword lookup.  pgen picks mult and size so that
+   the keywords of a grammar don't collide.  The result must not depend
+   on the machine, since the tables are computed by pgen. */
+
+int
+keywordhash(s, mult, size)
+	register char *s;
+	register int mult;
+	register int size;
+{
+	register long h = 0;
+	while (*s != '\0')
+		h = (h * mult + (*s++ & 0xff)) % size;
+	return (int)h;
+}
@@ -0,0 +1,1798 @@
+/* Direct-coded parser, written by pgen -d -- don't edit */
+
+#include "PROTO.h"
+#include "grammar.h"
+#include "token.h"
+#include "node.h"
+#include "parser.h"
+#include "errcode.h"
+
+#define SHIFT(arrow) \
+	if (shifttoken(&ps->p_stack, ps->p_tree, type, str, arrow) < 0) \
+		return E_NOMEM
+#define PUSH(nt, arrow) \
+	if (pushdfa(&ps->p_stack, ps->p_tree, nt, \
+		&ps->p_grammar->g_dfa[(nt) - NT_OFFSET], arrow) < 0) \
+		return E_NOMEM
+
+int
+gramparse(ps, ilabel, type, str)
+	register parser_state *ps;
+	register int ilabel;
+	int type;
+	char *str;
+{
+	register stackentry *top;
+	register state *s;
+
+ dispatch:
+	top = ps->p_stack.s_top;
+	switch (top->s_dfa->d_type) {
+	case 256:
+		switch (top->s_state) {
+		case 0: goto state_0_0;
+		case 1: goto state_0_1;
+		case 2: goto state_0_2;
+		}
+		break;
+	case 257:
+		switch (top->s_state) {
+		case 0: goto state_1_0;
+		case 1: goto state_1_1;
+		}
+		break;
+	case 258:
+		switch (top->s_state) {
+		case 0: goto state_2_0;
+		case 1: goto state_2_1;
+		case 2: goto state_2_2;
+		}
+		break;
+	case 259:
+		switch (top->s_state) {
+		case 0: goto state_3_0;
+		case 1: goto state_3_1;
+		case 2: goto state_3_2;
+		}
+		break;
+	case 260:
+		switch (top->s_state) {
+		case 0: goto state_4_0;
+		case 1: goto state_4_1;
+		case 2: goto state_4_2;
+		case 3: goto state_4_3;
+		case 4: goto state_4_4;
+		case 5: goto state_4_5;
+		}
+		break;
+	case 261:
+		switch (top->s_state) {
+		case 0: goto state_5_0;
+		case 1: goto state_5_1;
+		case 2: goto state_5_2;
+		case 3: goto state_5_3;
+		}
+		break;
+	case 262:
+		switch (top->s_state) {
+		case 0: goto state_6_0;
+		case 1: goto state_6_1;
+		}
+		break;
+	case 263:
+		switch (top->s_state) {
+		case 0: goto state_7_0;
+		case 1: goto state_7_1;
+		case 2: goto state_7_2;
+		case 3: goto state_7_3;
+		}
+		break;
+	case 264:
+		switch (top->s_state) {
+		case 0: goto state_8_0;
+		case 1: goto state_8_1;
+		}
+		break;
+	case 265:
+		switch (top->s_state) {
+		case 0: goto state_9_0;
+		case 1: goto state_9_1;
+		}
+		break;
+	case 266:
+		switch (top->s_state) {
+		case 0: goto state_10_0;
+		case 1: goto state_10_1;
+		case 2: goto state_10_2;
+		}
+		break;
+	case 267:
+		switch (top->s_state) {
+		case 0: goto state_11_0;
+		case 1: goto state_11_1;
+		case 2: goto state_11_2;
+		case 3: goto state_11_3;
+		}
+		break;
+	case 268:
+		switch (top->s_state) {
+		case 0: goto state_12_0;
+		case 1: goto state_12_1;
+		case 2: goto state_12_2;
+		case 3: goto state_12_3;
+		}
+		break;
+	case 269:
+		switch (top->s_state) {
+		case 0: goto state_13_0;
+		case 1: goto state_13_1;
+		case 2: goto state_13_2;
+		}
+		break;
+	case 270:
+		switch (top->s_state) {
+		case 0: goto state_14_0;
+		case 1: goto state_14_1;
+		}
+		break;
+	case 271:
+		switch (top->s_state) {
+		case 0: goto state_15_0;
+		case 1: goto state_15_1;
+		case 2: goto state_15_2;
+		}
+		break;
+	case 272:
+		switch (top->s_state) {
+		case 0: goto state_16_0;
+		case 1: goto state_16_1;
+		case 2: goto state_16_2;
+		case 3: goto state_16_3;
+		}
+		break;
+	case 273:
+		switch (top->s_state) {
+		case 0: goto state_17_0;
+		case 1: goto state_17_1;
+		case 2: goto state_17_2;
+		case 3: goto state_17_3;
+		case 4: goto state_17_4;
+		case 5: goto state_17_5;
+		}
+		break;
+	case 274:
+		switch (top->s_state) {
+		case 0: goto state_18_0;
+		case 1: goto state_18_1;
+		case 2: goto state_18_2;
+		case 3: goto state_18_3;
+		case 4: goto state_18_4;
+		case 5: goto state_18_5;
+		case 6: goto state_18_6;
+		case 7: goto state_18_7;
+		}
+		break;
+	case 275:
+		switch (top->s_state) {
+		case 0: goto state_19_0;
+		case 1: goto state_19_1;
+		}
+		break;
+	case 276:
+		switch (top->s_state) {
+		case 0: goto state_20_0;
+		case 1: goto state_20_1;
+		case 2: goto state_20_2;
+		case 3: goto state_20_3;
+		case 4: goto state_20_4;
+		case 5: goto state_20_5;
+		case 6: goto state_20_6;
+		case 7: goto state_20_7;
+		}
+		break;
+	case 277:
+		switch (top->s_state) {
+		case 0: goto state_21_0;
+		case 1: goto state_21_1;
+		case 2: goto state_21_2;
+		case 3: goto state_21_3;
+		case 4: goto state_21_4;
+		case 5: goto state_21_5;
+		case 6: goto state_21_6;
+		case 7: goto state_21_7;
+		}
+		break;
+	case 278:
+		switch (top->s_state) {
+		case 0: goto state_22_0;
+		case 1: goto state_22_1;
+		case 2: goto state_22_2;
+		case 3: goto state_22_3;
+		case 4: goto state_22_4;
+		case 5: goto state_22_5;
+		case 6: goto state_22_6;
+		case 7: goto state_22_7;
+		case 8: goto state_22_8;
+		case 9: goto state_22_9;
+		}
+		break;
+	case 279:
+		switch (top->s_state) {
+		case 0: goto state_23_0;
+		case 1: goto state_23_1;
+		case 2: goto state_23_2;
+		case 3: goto state_23_3;
+		case 4: goto state_23_4;
+		case 5: goto state_23_5;
+		case 6: goto state_23_6;
+		}
+		break;
+	case 280:
+		switch (top->s_state) {
+		case 0: goto state_24_0;
+		case 1: goto state_24_1;
+		case 2: goto state_24_2;
+		case 3: goto state_24_3;
+		case 4: goto state_24_4;
+		}
+		break;
+	case 281:
+		switch (top->s_state) {
+		case 0: goto state_25_0;
+		case 1: goto state_25_1;
+		case 2: goto state_25_2;
+		case 3: goto state_25_3;
+		case 4: goto state_25_4;
+		}
+		break;
+	case 282:
+		switch (top->s_state) {
+		case 0: goto state_26_0;
+		case 1: goto state_26_1;
+		}
+		break;
+	case 283:
+		switch (top->s_state) {
+		case 0: goto state_27_0;
+		case 1: goto state_27_1;
+		}
+		break;
+	case 284:
+		switch (top->s_state) {
+		case 0: goto state_28_0;
+		case 1: goto state_28_1;
+		case 2: goto state_28_2;
+		}
+		break;
+	case 285:
+		switch (top->s_state) {
+		case 0: goto state_29_0;
+		case 1: goto state_29_1;
+		}
+		break;
+	case 286:
+		switch (top->s_state) {
+		case 0: goto state_30_0;
+		case 1: goto state_30_1;
+		case 2: goto state_30_2;
+		case 3: goto state_30_3;
+		case 4: goto state_30_4;
+		case 5: goto state_30_5;
+		}
+		break;
+	case 287:
+		switch (top->s_state) {
+		case 0: goto state_31_0;
+		case 1: goto state_31_1;
+		}
+		break;
+	case 288:
+		switch (top->s_state) {
+		case 0: goto state_32_0;
+		case 1: goto state_32_1;
+		}
+		break;
+	case 289:
+		switch (top->s_state) {
+		case 0: goto state_33_0;
+		case 1: goto state_33_1;
+		case 2: goto state_33_2;
+		case 3: goto state_33_3;
+		}
+		break;
+	case 290:
+		switch (top->s_state) {
+		case 0: goto state_34_0;
+		case 1: goto state_34_1;
+		case 2: goto state_34_2;
+		case 3: goto state_34_3;
+		case 4: goto state_34_4;
+		case 5: goto state_34_5;
+		case 6: goto state_34_6;
+		case 7: goto state_34_7;
+		case 8: goto state_34_8;
+		}
+		break;
+	case 291:
+		switch (top->s_state) {
+		case 0: goto state_35_0;
+		case 1: goto state_35_1;
+		case 2: goto state_35_2;
+		case 3: goto state_35_3;
+		case 4: goto state_35_4;
+		case 5: goto state_35_5;
+		case 6: goto state_35_6;
+		}
+		break;
+	case 292:
+		switch (top->s_state) {
+		case 0: goto state_36_0;
+		case 1: goto state_36_1;
+		case 2: goto state_36_2;
+		case 3: goto state_36_3;
+		}
+		break;
+	case 293:
+		switch (top->s_state) {
+		case 0: goto state_37_0;
+		case 1: goto state_37_1;
+		case 2: goto state_37_2;
+		}
+		break;
+	case 294:
+		switch (top->s_state) {
+		case 0: goto state_38_0;
+		case 1: goto state_38_1;
+		case 2: goto state_38_2;
+		}
+		break;
+	case 295:
+		switch (top->s_state) {
+		case 0: goto state_39_0;
+		case 1: goto state_39_1;
+		case 2: goto state_39_2;
+		case 3: goto state_39_3;
+		case 4: goto state_39_4;
+		case 5: goto state_39_5;
+		case 6: goto state_39_6;
+		case 7: goto state_39_7;
+		}
+		break;
+	case 296:
+		switch (top->s_state) {
+		case 0: goto state_40_0;
+		case 1: goto state_40_1;
+		case 2: goto state_40_2;
+		}
+		break;
+	case 297:
+		switch (top->s_state) {
+		case 0: goto state_41_0;
+		case 1: goto state_41_1;
+		case 2: goto state_41_2;
+		case 3: goto state_41_3;
+		}
+		break;
+	}
+	return E_SYNTAX;
+
+ state_0_0:	/* single_input */
+	switch (ilabel) {
+	case 2:
+		SHIFT(1);
+		goto popaccepted;
+	case 12: case 49: case 52: case 53: case 55: case 88:
+		PUSH(275, 2);
+		goto state_19_0;
+	case 13: case 17: case 30: case 32: case 33: case 37: case 38: case 39: case 41: case 42: case 72: case 73: case 79: case 81: case 83: case 84: case 85:
+		PUSH(265, 1);
+		goto state_9_0;
+	}
+	return E_SYNTAX;
+
+ state_0_1:	/* single_input */
+	goto popretry;
+
+ state_0_2:	/* single_input */
+	switch (ilabel) {
+	case 2:
+		SHIFT(1);
+		goto popaccepted;
+	}
+	return E_SYNTAX;
+
+ state_1_0:	/* file_input */
+	switch (ilabel) {
+	case 2:
+		SHIFT(0);
+		return E_OK;
+	case 7:
+		SHIFT(1);
+		goto popaccepted;
+	case 12: case 13: case 17: case 30: case 32: case 33: case 37: case 38: case 39: case 41: case 42: case 49: case 52: case 53: case 55: case 72: case 73: case 79: case 81: case 83: case 84: case 85: case 88:
+		PUSH(264, 0);
+		goto state_8_0;
+	}
+	return E_SYNTAX;
+
+ state_1_1:	/* file_input */
+	goto popretry;
+
+ state_2_0:	/* expr_input */
+	switch (ilabel) {
+	case 13: case 17: case 65: case 72: case 73: case 79: case 81: case 83: case 84: case 85:
+		PUSH(294, 1);
+		goto state_38_0;
+	}
+	return E_SYNTAX;
+
+ state_2_1:	/* expr_input */
+	switch (ilabel) {
+	case 2:
+		SHIFT(2);
+		goto popaccepted;
+	}
+	return E_SYNTAX;
+
+ state_2_2:	/* expr_input */
+	goto popretry;
+
+ state_3_0:	/* eval_input */
+	switch (ilabel) {
+	case 13: case 17: case 65: case 72: case 73: case 79: case 81: case 83: case 84: case 85:
+		PUSH(294, 1);
+		goto state_38_0;
+	}
+	return E_SYNTAX;
+
+ state_3_1:	/* eval_input */
+	switch (ilabel) {
+	case 7:
+		SHIFT(2);
+		goto popaccepted;
+	}
+	return E_SYNTAX;
+
+ state_3_2:	/* eval_input */
+	goto popretry;
+
+ state_4_0:	/* funcdef */
+	switch (ilabel) {
+	case 12:
+		SHIFT(1);
+		return E_OK;
+	}
+	return E_SYNTAX;
+
+ state_4_1:	/* funcdef */
+	switch (ilabel) {
+	case 13:
+		SHIFT(2);
+		return E_OK;
+	}
+	return E_SYNTAX;
+
+ state_4_2:	/* funcdef */
+	switch (ilabel) {
+	case 17:
+		PUSH(261, 3);
+		goto state_5_0;
+	}
+	return E_SYNTAX;
+
+ state_4_3:	/* funcdef */
+	switch (ilabel) {
+	case 15:
+		SHIFT(4);
+		return E_OK;
+	}
+	return E_SYNTAX;
+
+ state_4_4:	/* funcdef */
+	switch (ilabel) {
+	case 2: case 13: case 17: case 30: case 32: case 33: case 37: case 38: case 39: case 41: case 42: case 72: case 73: case 79: case 81: case 83: case 84: case 85:
+		PUSH(281, 5);
+		goto state_25_0;
+	}
+	return E_SYNTAX;
+
+ state_4_5:	/* funcdef */
+	goto popretry;
+
+ state_5_0:	/* parameters */
+	switch (ilabel) {
+	case 17:
+		SHIFT(1);
+		return E_OK;
+	}
+	return E_SYNTAX;
+
+ state_5_1:	/* parameters */
+	switch (ilabel) {
+	case 13: case 17:
+		PUSH(262, 2);
+		goto state_6_0;
+	case 19:
+		SHIFT(3);
+		goto popaccepted;
+	}
+	return E_SYNTAX;
+
+ state_5_2:	/* parameters */
+	switch (ilabel) {
+	case 19:
+		SHIFT(3);
+		goto popaccepted;
+	}
+	return E_SYNTAX;
+
+ state_5_3:	/* parameters */
+	goto popretry;
+
+ state_6_0:	/* fplist */
+	switch (ilabel) {
+	case 13: case 17:
+		PUSH(263, 1);
+		goto state_7_0;
+	}
+	return E_SYNTAX;
+
+ state_6_1:	/* fplist */
+	switch (ilabel) {
+	case 21:
+		SHIFT(0);
+		return E_OK;
+	}
+	goto popretry;
+
+ state_7_0:	/* fpdef */
+	switch (ilabel) {
+	case 13:
+		SHIFT(1);
+		goto popaccepted;
+	case 17:
+		SHIFT(2);
+		return E_OK;
+	}
+	return E_SYNTAX;
+
+ state_7_1:	/* fpdef */
+	goto popretry;
+
+ state_7_2:	/* fpdef */
+	switch (ilabel) {
+	case 13: case 17:
+		PUSH(262, 3);
+		goto state_6_0;
+	}
+	return E_SYNTAX;
+
+ state_7_3:	/* fpdef */
+	switch (ilabel) {
+	case 19:
+		SHIFT(1);
+		goto popaccepted;
+	}
+	return E_SYNTAX;
+
+ state_8_0:	/* stmt */
+	switch (ilabel) {
+	case 12: case 49: case 52: case 53: case 55: case 88:
+		PUSH(275, 1);
+		goto state_19_0;
+	case 13: case 17: case 30: case 32: case 33: case 37: case 38: case 39: case 41: case 42: case 72: case 73: case 79: case 81: case 83: case 84: case 85:
+		PUSH(265, 1);
+		goto state_9_0;
+	}
+	return E_SYNTAX;
+
+ state_8_1:	/* stmt */
+	goto popretry;
+
+ state_9_0:	/* simple_stmt */
+	switch (ilabel) {
+	case 13: case 17: case 72: case 73: case 79: case 81: case 83: case 84: case 85:
+		PUSH(266, 1);
+		goto state_10_0;
+	case 30:
+		PUSH(267, 1);
+		goto state_11_0;
+	case 32:
+		PUSH(268, 1);
+		goto state_12_0;
+	case 33:
+		PUSH(269, 1);
+		goto state_13_0;
+	case 37: case 38: case 39:
+		PUSH(270, 1);
+		goto state_14_0;
+	case 41: case 42:
+		PUSH(274, 1);
+		goto state_18_0;
+	}
+	return E_SYNTAX;
+
+ state_9_1:	/* simple_stmt */
+	goto popretry;
+
+ state_10_0:	/* expr_stmt */
+	switch (ilabel) {
+	case 13: case 17: case 72: case 73: case 79: case 81: case 83: case 84: case 85:
+		PUSH(293, 1);
+		goto state_37_0;
+	}
+	return E_SYNTAX;
+
+ state_10_1:	/* expr_stmt */
+	switch (ilabel) {
+	case 2:
+		SHIFT(2);
+		goto popaccepted;
+	case 29:
+		SHIFT(0);
+		return E_OK;
+	}
+	return E_SYNTAX;
+
+ state_10_2:	/* expr_stmt */
+	goto popretry;
+
+ state_11_0:	/* print_stmt */
+	switch (ilabel) {
+	case 30:
+		SHIFT(1);
+		return E_OK;
+	}
+	return E_SYNTAX;
+
+ state_11_1:	/* print_stmt */
+	switch (ilabel) {
+	case 2:
+		SHIFT(3);
+		goto popaccepted;
+	case 13: case 17: case 65: case 72: case 73: case 79: case 81: case 83: case 84: case 85:
+		PUSH(282, 2);
+		goto state_26_0;
+	}
+	return E_SYNTAX;
+
+ state_11_2:	/* print_stmt */
+	switch (ilabel) {
+	case 2:
+		SHIFT(3);
+		goto popaccepted;
+	case 21:
+		SHIFT(1);
+		return E_OK;
+	}
+	return E_SYNTAX;
+
+ state_11_3:	/* print_stmt */
+	goto popretry;
+
+ state_12_0:	/* del_stmt */
+	switch (ilabel) {
+	case 32:
+		SHIFT(1);
+		return E_OK;
+	}
+	return E_SYNTAX;
+
+ state_12_1:	/* del_stmt */
+	switch (ilabel) {
+	case 13: case 17: case 72: case 73: case 79: case 81: case 83: case 84: case 85:
+		PUSH(293, 2);
+		goto state_37_0;
+	}
+	return E_SYNTAX;
+
+ state_12_2:	/* del_stmt */
+	switch (ilabel) {
+	case 2:
+		SHIFT(3);
+		goto popaccepted;
+	}
+	return E_SYNTAX;
+
+ state_12_3:	/* del_stmt */
+	goto popretry;
+
+ state_13_0:	/* pass_stmt */
+	switch (ilabel) {
+	case 33:
+		SHIFT(1);
+		return E_OK;
+	}
+	return E_SYNTAX;
+
+ state_13_1:	/* pass_stmt */
+	switch (ilabel) {
+	case 2:
+		SHIFT(2);
+		goto popaccepted;
+	}
+	return E_SYNTAX;
+
+ state_13_2:	/* pass_stmt */
+	goto popretry;
+
+ state_14_0:	/* flow_stmt */
+	switch (ilabel) {
+	case 37:
+		PUSH(271, 1);
+		goto state_15_0;
+	case 38:
+		PUSH(272, 1);
+		goto state_16_0;
+	case 39:
+		PUSH(273, 1);
+		goto state_17_0;
+	}
+	return E_SYNTAX;
+
+ state_14_1:	/* flow_stmt */
+	goto popretry;
+
+ state_15_0:	/* break_stmt */
+	switch (ilabel) {
+	case 37:
+		SHIFT(1);
+		return E_OK;
+	}
+	return E_SYNTAX;
+
+ state_15_1:	/* break_stmt */
+	switch (ilabel) {
+	case 2:
+		SHIFT(2);
+		goto popaccepted;
+	}
+	return E_SYNTAX;
+
+ state_15_2:	/* break_stmt */
+	goto popretry;
+
+ state_16_0:	/* return_stmt */
+	switch (ilabel) {
+	case 38:
+		SHIFT(1);
+		return E_OK;
+	}
+	return E_SYNTAX;
+
+ state_16_1:	/* return_stmt */
+	switch (ilabel) {
+	case 2:
+		SHIFT(3);
+		goto popaccepted;
+	case 13: case 17: case 65: case 72: case 73: case 79: case 81: case 83: case 84: case 85:
+		PUSH(294, 2);
+		goto state_38_0;
+	}
+	return E_SYNTAX;
+
+ state_16_2:	/* return_stmt */
+	switch (ilabel) {
+	case 2:
+		SHIFT(3);
+		goto popaccepted;
+	}
+	return E_SYNTAX;
+
+ state_16_3:	/* return_stmt */
+	goto popretry;
+
+ state_17_0:	/* raise_stmt */
+	switch (ilabel) {
+	case 39:
+		SHIFT(1);
+		return E_OK;
+	}
+	return E_SYNTAX;
+
+ state_17_1:	/* raise_stmt */
+	switch (ilabel) {
+	case 13: case 17: case 72: case 73: case 79: case 81: case 83: case 84: case 85:
+		PUSH(287, 2);
+		goto state_31_0;
+	}
+	return E_SYNTAX;
+
+ state_17_2:	/* raise_stmt */
+	switch (ilabel) {
+	case 2:
+		SHIFT(4);
+		goto popaccepted;
+	case 21:
+		SHIFT(3);
+		return E_OK;
+	}
+	return E_SYNTAX;
+
+ state_17_3:	/* raise_stmt */
+	switch (ilabel) {
+	case 13: case 17: case 72: case 73: case 79: case 81: case 83: case 84: case 85:
+		PUSH(287, 5);
+		goto state_31_0;
+	}
+	return E_SYNTAX;
+
+ state_17_4:	/* raise_stmt */
+	goto popretry;
+
+ state_17_5:	/* raise_stmt */
+	switch (ilabel) {
+	case 2:
+		SHIFT(4);
+		goto popaccepted;
+	}
+	return E_SYNTAX;
+
+ state_18_0:	/* import_stmt */
+	switch (ilabel) {
+	case 41:
+		SHIFT(1);
+		return E_OK;
+	case 42:
+		SHIFT(2);
+		return E_OK;
+	}
+	return E_SYNTAX;
+
+ state_18_1:	/* import_stmt */
+	switch (ilabel) {
+	case 13:
+		SHIFT(3);
+		return E_OK;
+	}
+	return E_SYNTAX;
+
+ state_18_2:	/* import_stmt */
+	switch (ilabel) {
+	case 13:
+		SHIFT(4);
+		return E_OK;
+	}
+	return E_SYNTAX;
+
+ state_18_3:	/* import_stmt */
+	switch (ilabel) {
+	case 2:
+		SHIFT(5);
+		goto popaccepted;
+	case 21:
+		SHIFT(1);
+		return E_OK;
+	}
+	return E_SYNTAX;
+
+ state_18_4:	/* import_stmt */
+	switch (ilabel) {
+	case 41:
+		SHIFT(6);
+		return E_OK;
+	}
+	return E_SYNTAX;
+
+ state_18_5:	/* import_stmt */
+	goto popretry;
+
+ state_18_6:	/* import_stmt */
+	switch (ilabel) {
+	case 13:
+		SHIFT(3);
+		return E_OK;
+	case 43:
+		SHIFT(7);
+		return E_OK;
+	}
+	return E_SYNTAX;
+
+ state_18_7:	/* import_stmt */
+	switch (ilabel) {
+	case 2:
+		SHIFT(5);
+		goto popaccepted;
+	}
+	return E_SYNTAX;
+
+ state_19_0:	/* compound_stmt */
+	switch (ilabel) {
+	case 12:
+		PUSH(260, 1);
+		goto state_4_0;
+	case 49:
+		PUSH(276, 1);
+		goto state_20_0;
+	case 52:
+		PUSH(277, 1);
+		goto state_21_0;
+	case 53:
+		PUSH(278, 1);
+		goto state_22_0;
+	case 55:
+		PUSH(279, 1);
+		goto state_23_0;
+	case 88:
+		PUSH(295, 1);
+		goto state_39_0;
+	}
+	return E_SYNTAX;
+
+ state_19_1:	/* compound_stmt */
+	goto popretry;
+
+ state_20_0:	/* if_stmt */
+	switch (ilabel) {
+	case 49:
+		SHIFT(1);
+		return E_OK;
+	}
+	return E_SYNTAX;
+
+ state_20_1:	/* if_stmt */
+	switch (ilabel) {
+	case 13: case 17: case 65: case 72: case 73: case 79: case 81: case 83: case 84: case 85:
+		PUSH(282, 2);
+		goto state_26_0;
+	}
+	return E_SYNTAX;
+
+ state_20_2:	/* if_stmt */
+	switch (ilabel) {
+	case 15:
+		SHIFT(3);
+		return E_OK;
+	}
+	return E_SYNTAX;
+
+ state_20_3:	/* if_stmt */
+	switch (ilabel) {
+	case 2: case 13: case 17: case 30: case 32: case 33: case 37: case 38: case 39: case 41: case 42: case 72: case 73: case 79: case 81: case 83: case 84: case 85:
+		PUSH(281, 4);
+		goto state_25_0;
+	}
+	return E_SYNTAX;
+
+ state_20_4:	/* if_stmt */
+	switch (ilabel) {
+	case 50:
+		SHIFT(1);
+		return E_OK;
+	case 51:
+		SHIFT(5);
+		return E_OK;
+	}
+	goto popretry;
+
+ state_20_5:	/* if_stmt */
+	switch (ilabel) {
+	case 15:
+		SHIFT(6);
+		return E_OK;
+	}
+	return E_SYNTAX;
+
+ state_20_6:	/* if_stmt */
+	switch (ilabel) {
+	case 2: case 13: case 17: case 30: case 32: case 33: case 37: case 38: case 39: case 41: case 42: case 72: case 73: case 79: case 81: case 83: case 84: case 85:
+		PUSH(281, 7);
+		goto state_25_0;
+	}
+	return E_SYNTAX;
+
+ state_20_7:	/* if_stmt */
+	goto popretry;
+
+ state_21_0:	/* while_stmt */
+	switch (ilabel) {
+	case 52:
+		SHIFT(1);
+		return E_OK;
+	}
+	return E_SYNTAX;
+
+ state_21_1:	/* while_stmt */
+	switch (ilabel) {
+	case 13: case 17: case 65: case 72: case 73: case 79: case 81: case 83: case 84: case 85:
+		PUSH(282, 2);
+		goto state_26_0;
+	}
+	return E_SYNTAX;
+
+ state_21_2:	/* while_stmt */
+	switch (ilabel) {
+	case 15:
+		SHIFT(3);
+		return E_OK;
+	}
+	return E_SYNTAX;
+
+ state_21_3:	/* while_stmt */
+	switch (ilabel) {
+	case 2: case 13: case 17: case 30: case 32: case 33: case 37: case 38: case 39: case 41: case 42: case 72: case 73: case 79: case 81: case 83: case 84: case 85:
+		PUSH(281, 4);
+		goto state_25_0;
+	}
+	return E_SYNTAX;
+
+ state_21_4:	/* while_stmt */
+	switch (ilabel) {
+	case 51:
+		SHIFT(5);
+		return E_OK;
+	}
+	goto popretry;
+
+ state_21_5:	/* while_stmt */
+	switch (ilabel) {
+	case 15:
+		SHIFT(6);
+		return E_OK;
+	}
+	return E_SYNTAX;
+
+ state_21_6:	/* while_stmt */
+	switch (ilabel) {
+	case 2: case 13: case 17: case 30: case 32: case 33: case 37: case 38: case 39: case 41: case 42: case 72: case 73: case 79: case 81: case 83: case 84: case 85:
+		PUSH(281, 7);
+		goto state_25_0;
+	}
+	return E_SYNTAX;
+
+ state_21_7:	/* while_stmt */
+	goto popretry;
+
+ state_22_0:	/* for_stmt */
+	switch (ilabel) {
+	case 53:
+		SHIFT(1);
+		return E_OK;
+	}
+	return E_SYNTAX;
+
+ state_22_1:	/* for_stmt */
+	switch (ilabel) {
+	case 13: case 17: case 72: case 73: case 79: case 81: case 83: case 84: case 85:
+		PUSH(293, 2);
+		goto state_37_0;
+	}
+	return E_SYNTAX;
+
+ state_22_2:	/* for_stmt */
+	switch (ilabel) {
+	case 54:
+		SHIFT(3);
+		return E_OK;
+	}
+	return E_SYNTAX;
+
+ state_22_3:	/* for_stmt */
+	switch (ilabel) {
+	case 13: case 17: case 72: case 73: case 79: case 81: case 83: case 84: case 85:
+		PUSH(293, 4);
+		goto state_37_0;
+	}
+	return E_SYNTAX;
+
+ state_22_4:	/* for_stmt */
+	switch (ilabel) {
+	case 15:
+		SHIFT(5);
+		return E_OK;
+	}
+	return E_SYNTAX;
+
+ state_22_5:	/* for_stmt */
+	switch (ilabel) {
+	case 2: case 13: case 17: case 30: case 32: case 33: case 37: case 38: case 39: case 41: case 42: case 72: case 73: case 79: case 81: case 83: case 84: case 85:
+		PUSH(281, 6);
+		goto state_25_0;
+	}
+	return E_SYNTAX;
+
+ state_22_6:	/* for_stmt */
+	switch (ilabel) {
+	case 51:
+		SHIFT(7);
+		return E_OK;
+	}
+	goto popretry;
+
+ state_22_7:	/* for_stmt */
+	switch (ilabel) {
+	case 15:
+		SHIFT(8);
+		return E_OK;
+	}
+	return E_SYNTAX;
+
+ state_22_8:	/* for_stmt */
+	switch (ilabel) {
+	case 2: case 13: case 17: case 30: case 32: case 33: case 37: case 38: case 39: case 41: case 42: case 72: case 73: case 79: case 81: case 83: case 84: case 85:
+		PUSH(281, 9);
+		goto state_25_0;
+	}
+	return E_SYNTAX;
+
+ state_22_9:	/* for_stmt */
+	goto popretry;
+
+ state_23_0:	/* try_stmt */
+	switch (ilabel) {
+	case 55:
+		SHIFT(1);
+		return E_OK;
+	}
+	return E_SYNTAX;
+
+ state_23_1:	/* try_stmt */
+	switch (ilabel) {
+	case 15:
+		SHIFT(2);
+		return E_OK;
+	}
+	return E_SYNTAX;
+
+ state_23_2:	/* try_stmt */
+	switch (ilabel) {
+	case 2: case 13: case 17: case 30: case 32: case 33: case 37: case 38: case 39: case 41: case 42: case 72: case 73: case 79: case 81: case 83: case 84: case 85:
+		PUSH(281, 3);
+		goto state_25_0;
+	}
+	return E_SYNTAX;
+
+ state_23_3:	/* try_stmt */
+	switch (ilabel) {
+	case 57:
+		SHIFT(4);
+		return E_OK;
+	case 58:
+		PUSH(280, 1);
+		goto state_24_0;
+	}
+	goto popretry;
+
+ state_23_4:	/* try_stmt */
+	switch (ilabel) {
+	case 15:
+		SHIFT(5);
+		return E_OK;
+	}
+	return E_SYNTAX;
+
+ state_23_5:	/* try_stmt */
+	switch (ilabel) {
+	case 2: case 13: case 17: case 30: case 32: case 33: case 37: case 38: case 39: case 41: case 42: case 72: case 73: case 79: case 81: case 83: case 84: case 85:
+		PUSH(281, 6);
+		goto state_25_0;
+	}
+	return E_SYNTAX;
+
+ state_23_6:	/* try_stmt */
+	goto popretry;
+
+ state_24_0:	/* except_clause */
+	switch (ilabel) {
+	case 58:
+		SHIFT(1);
+		return E_OK;
+	}
+	return E_SYNTAX;
+
+ state_24_1:	/* except_clause */
+	switch (ilabel) {
+	case 13: case 17: case 72: case 73: case 79: case 81: case 83: case 84: case 85:
+		PUSH(287, 2);
+		goto state_31_0;
+	}
+	goto popretry;
+
+ state_24_2:	/* except_clause */
+	switch (ilabel) {
+	case 21:
+		SHIFT(3);
+		return E_OK;
+	}
+	goto popretry;
+
+ state_24_3:	/* except_clause */
+	switch (ilabel) {
+	case 13: case 17: case 72: case 73: case 79: case 81: case 83: case 84: case 85:
+		PUSH(287, 4);
+		goto state_31_0;
+	}
+	return E_SYNTAX;
+
+ state_24_4:	/* except_clause */
+	goto popretry;
+
+ state_25_0:	/* suite */
+	switch (ilabel) {
+	case 2:
+		SHIFT(2);
+		return E_OK;
+	case 13: case 17: case 30: case 32: case 33: case 37: case 38: case 39: case 41: case 42: case 72: case 73: case 79: case 81: case 83: case 84: case 85:
+		PUSH(265, 1);
+		goto state_9_0;
+	}
+	return E_SYNTAX;
+
+ state_25_1:	/* suite */
+	goto popretry;
+
+ state_25_2:	/* suite */
+	switch (ilabel) {
+	case 59:
+		SHIFT(3);
+		return E_OK;
+	}
+	return E_SYNTAX;
+
+ state_25_3:	/* suite */
+	switch (ilabel) {
+	case 2:
+		SHIFT(3);
+		return E_OK;
+	case 12: case 13: case 17: case 30: case 32: case 33: case 37: case 38: case 39: case 41: case 42: case 49: case 52: case 53: case 55: case 72: case 73: case 79: case 81: case 83: case 84: case 85: case 88:
+		PUSH(264, 4);
+		goto state_8_0;
+	}
+	return E_SYNTAX;
+
+ state_25_4:	/* suite */
+	switch (ilabel) {
+	case 2:
+		SHIFT(4);
+		return E_OK;
+	case 12: case 13: case 17: case 30: case 32: case 33: case 37: case 38: case 39: case 41: case 42: case 49: case 52: case 53: case 55: case 72: case 73: case 79: case 81: case 83: case 84: case 85: case 88:
+		PUSH(264, 4);
+		goto state_8_0;
+	case 60:
+		SHIFT(1);
+		goto popaccepted;
+	}
+	return E_SYNTAX;
+
+ state_26_0:	/* test */
+	switch (ilabel) {
+	case 13: case 17: case 65: case 72: case 73: case 79: case 81: case 83: case 84: case 85:
+		PUSH(283, 1);
+		goto state_27_0;
+	}
+	return E_SYNTAX;
+
+ state_26_1:	/* test */
+	switch (ilabel) {
+	case 62:
+		SHIFT(0);
+		return E_OK;
+	}
+	goto popretry;
+
+ state_27_0:	/* and_test */
+	switch (ilabel) {
+	case 13: case 17: case 65: case 72: case 73: case 79: case 81: case 83: case 84: case 85:
+		PUSH(284, 1);
+		goto state_28_0;
+	}
+	return E_SYNTAX;
+
+ state_27_1:	/* and_test */
+	switch (ilabel) {
+	case 64:
+		SHIFT(0);
+		return E_OK;
+	}
+	goto popretry;
+
+ state_28_0:	/* not_test */
+	switch (ilabel) {
+	case 13: case 17: case 72: case 73: case 79: case 81: case 83: case 84: case 85:
+		PUSH(285, 2);
+		goto state_29_0;
+	case 65:
+		SHIFT(1);
+		return E_OK;
+	}
+	return E_SYNTAX;
+
+ state_28_1:	/* not_test */
+	switch (ilabel) {
+	case 13: case 17: case 65: case 72: case 73: case 79: case 81: case 83: case 84: case 85:
+		PUSH(284, 2);
+		goto state_28_0;
+	}
+	return E_SYNTAX;
+
+ state_28_2:	/* not_test */
+	goto popretry;
+
+ state_29_0:	/* comparison */
+	switch (ilabel) {
+	case 13: case 17: case 72: case 73: case 79: case 81: case 83: case 84: case 85:
+		PUSH(287, 1);
+		goto state_31_0;
+	}
+	return E_SYNTAX;
+
+ state_29_1:	/* comparison */
+	switch (ilabel) {
+	case 29: case 54: case 65: case 68: case 69: case 70:
+		PUSH(286, 0);
+		goto state_30_0;
+	}
+	goto popretry;
+
+ state_30_0:	/* comp_op */
+	switch (ilabel) {
+	case 29: case 54:
+		SHIFT(3);
+		goto popaccepted;
+	case 65:
+		SHIFT(4);
+		return E_OK;
+	case 68:
+		SHIFT(1);
+		return E_OK;
+	case 69:
+		SHIFT(2);
+		return E_OK;
+	case 70:
+		SHIFT(5);
+		return E_OK;
+	}
+	return E_SYNTAX;
+
+ state_30_1:	/* comp_op */
+	switch (ilabel) {
+	case 29: case 69:
+		SHIFT(3);
+		goto popaccepted;
+	}
+	goto popretry;
+
+ state_30_2:	/* comp_op */
+	switch (ilabel) {
+	case 29:
+		SHIFT(3);
+		goto popaccepted;
+	}
+	goto popretry;
+
+ state_30_3:	/* comp_op */
+	goto popretry;
+
+ state_30_4:	/* comp_op */
+	switch (ilabel) {
+	case 54:
+		SHIFT(3);
+		goto popaccepted;
+	}
+	return E_SYNTAX;
+
+ state_30_5:	/* comp_op */
+	switch (ilabel) {
+	case 65:
+		SHIFT(3);
+		goto popaccepted;
+	}
+	goto popretry;
+
+ state_31_0:	/* expr */
+	switch (ilabel) {
+	case 13: case 17: case 72: case 73: case 79: case 81: case 83: case 84: case 85:
+		PUSH(288, 1);
+		goto state_32_0;
+	}
+	return E_SYNTAX;
+
+ state_31_1:	/* expr */
+	switch (ilabel) {
+	case 72: case 73:
+		SHIFT(0);
+		return E_OK;
+	}
+	goto popretry;
+
+ state_32_0:	/* term */
+	switch (ilabel) {
+	case 13: case 17: case 72: case 73: case 79: case 81: case 83: case 84: case 85:
+		PUSH(289, 1);
+		goto state_33_0;
+	}
+	return E_SYNTAX;
+
+ state_32_1:	/* term */
+	switch (ilabel) {
+	case 43: case 75: case 76:
+		SHIFT(0);
+		return E_OK;
+	}
+	goto popretry;
+
+ state_33_0:	/* factor */
+	switch (ilabel) {
+	case 13: case 17: case 79: case 81: case 83: case 84: case 85:
+		PUSH(290, 2);
+		goto state_34_0;
+	case 72: case 73:
+		SHIFT(1);
+		return E_OK;
+	}
+	return E_SYNTAX;
+
+ state_33_1:	/* factor */
+	switch (ilabel) {
+	case 13: case 17: case 72: case 73: case 79: case 81: case 83: case 84: case 85:
+		PUSH(289, 3);
+		goto state_33_0;
+	}
+	return E_SYNTAX;
+
+ state_33_2:	/* factor */
+	switch (ilabel) {
+	case 17: case 79: case 87:
+		PUSH(291, 2);
+		goto state_35_0;
+	}
+	goto popretry;
+
+ state_33_3:	/* factor */
+	goto popretry;
+
+ state_34_0:	/* atom */
+	switch (ilabel) {
+	case 13: case 84: case 85:
+		SHIFT(5);
+		goto popaccepted;
+	case 17:
+		SHIFT(1);
+		return E_OK;
+	case 79:
+		SHIFT(2);
+		return E_OK;
+	case 81:
+		SHIFT(3);
+		return E_OK;
+	case 83:
+		SHIFT(4);
+		return E_OK;
+	}
+	return E_SYNTAX;
+
+ state_34_1:	/* atom */
+	switch (ilabel) {
+	case 13: case 17: case 65: case 72: case 73: case 79: case 81: case 83: case 84: case 85:
+		PUSH(294, 6);
+		goto state_38_0;
+	case 19:
+		SHIFT(5);
+		goto popaccepted;
+	}
+	return E_SYNTAX;
+
+ state_34_2:	/* atom */
+	switch (ilabel) {
+	case 13: case 17: case 65: case 72: case 73: case 79: case 81: case 83: case 84: case 85:
+		PUSH(294, 7);
+		goto state_38_0;
+	case 80:
+		SHIFT(5);
+		goto popaccepted;
+	}
+	return E_SYNTAX;
+
+ state_34_3:	/* atom */
+	switch (ilabel) {
+	case 82:
+		SHIFT(5);
+		goto popaccepted;
+	}
+	return E_SYNTAX;
+
+ state_34_4:	/* atom */
+	switch (ilabel) {
+	case 13: case 17: case 65: case 72: case 73: case 79: case 81: case 83: case 84: case 85:
+		PUSH(294, 8);
+		goto state_38_0;
+	}
+	return E_SYNTAX;
+
+ state_34_5:	/* atom */
+	goto popretry;
+
+ state_34_6:	/* atom */
+	switch (ilabel) {
+	case 19:
+		SHIFT(5);
+		goto popaccepted;
+	}
+	return E_SYNTAX;
+
+ state_34_7:	/* atom */
+	switch (ilabel) {
+	case 80:
+		SHIFT(5);
+		goto popaccepted;
+	}
+	return E_SYNTAX;
+
+ state_34_8:	/* atom */
+	switch (ilabel) {
+	case 83:
+		SHIFT(5);
+		goto popaccepted;
+	}
+	return E_SYNTAX;
+
+ state_35_0:	/* trailer */
+	switch (ilabel) {
+	case 17:
+		SHIFT(1);
+		return E_OK;
+	case 79:
+		SHIFT(2);
+		return E_OK;
+	case 87:
+		SHIFT(3);
+		return E_OK;
+	}
+	return E_SYNTAX;
+
+ state_35_1:	/* trailer */
+	switch (ilabel) {
+	case 13: case 17: case 65: case 72: case 73: case 79: case 81: case 83: case 84: case 85:
+		PUSH(294, 4);
+		goto state_38_0;
+	case 19:
+		SHIFT(5);
+		goto popaccepted;
+	}
+	return E_SYNTAX;
+
+ state_35_2:	/* trailer */
+	switch (ilabel) {
+	case 13: case 15: case 17: case 72: case 73: case 79: case 81: case 83: case 84: case 85:
+		PUSH(292, 6);
+		goto state_36_0;
+	}
+	return E_SYNTAX;
+
+ state_35_3:	/* trailer */
+	switch (ilabel) {
+	case 13:
+		SHIFT(5);
+		goto popaccepted;
+	}
+	return E_SYNTAX;
+
+ state_35_4:	/* trailer */
+	switch (ilabel) {
+	case 19:
+		SHIFT(5);
+		goto popaccepted;
+	}
+	return E_SYNTAX;
+
+ state_35_5:	/* trailer */
+	goto popretry;
+
+ state_35_6:	/* trailer */
+	switch (ilabel) {
+	case 80:
+		SHIFT(5);
+		goto popaccepted;
+	}
+	return E_SYNTAX;
+
+ state_36_0:	/* subscript */
+	switch (ilabel) {
+	case 13: case 17: case 72: case 73: case 79: case 81: case 83: case 84: case 85:
+		PUSH(287, 1);
+		goto state_31_0;
+	case 15:
+		SHIFT(2);
+		return E_OK;
+	}
+	return E_SYNTAX;
+
+ state_36_1:	/* subscript */
+	switch (ilabel) {
+	case 15:
+		SHIFT(2);
+		return E_OK;
+	}
+	goto popretry;
+
+ state_36_2:	/* subscript */
+	switch (ilabel) {
+	case 13: case 17: case 72: case 73: case 79: case 81: case 83: case 84: case 85:
+		PUSH(287, 3);
+		goto state_31_0;
+	}
+	goto popretry;
+
+ state_36_3:	/* subscript */
+	goto popretry;
+
+ state_37_0:	/* exprlist */
+	switch (ilabel) {
+	case 13: case 17: case 72: case 73: case 79: case 81: case 83: case 84: case 85:
+		PUSH(287, 1);
+		goto state_31_0;
+	}
+	return E_SYNTAX;
+
+ state_37_1:	/* exprlist */
+	switch (ilabel) {
+	case 21:
+		SHIFT(2);
+		return E_OK;
+	}
+	goto popretry;
+
+ state_37_2:	/* exprlist */
+	switch (ilabel) {
+	case 13: case 17: case 72: case 73: case 79: case 81: case 83: case 84: case 85:
+		PUSH(287, 1);
+		goto state_31_0;
+	}
+	goto popretry;
+
+ state_38_0:	/* testlist */
+	switch (ilabel) {
+	case 13: case 17: case 65: case 72: case 73: case 79: case 81: case 83: case 84: case 85:
+		PUSH(282, 1);
+		goto state_26_0;
+	}
+	return E_SYNTAX;
+
+ state_38_1:	/* testlist */
+	switch (ilabel) {
+	case 21:
+		SHIFT(2);
+		return E_OK;
+	}
+	goto popretry;
+
+ state_38_2:	/* testlist */
+	switch (ilabel) {
+	case 13: case 17: case 65: case 72: case 73: case 79: case 81: case 83: case 84: case 85:
+		PUSH(282, 1);
+		goto state_26_0;
+	}
+	goto popretry;
+
+ state_39_0:	/* classdef */
+	switch (ilabel) {
+	case 88:
+		SHIFT(1);
+		return E_OK;
+	}
+	return E_SYNTAX;
+
+ state_39_1:	/* classdef */
+	switch (ilabel) {
+	case 13:
+		SHIFT(2);
+		return E_OK;
+	}
+	return E_SYNTAX;
+
+ state_39_2:	/* classdef */
+	switch (ilabel) {
+	case 17:
+		PUSH(261, 3);
+		goto state_5_0;
+	}
+	return E_SYNTAX;
+
+ state_39_3:	/* classdef */
+	switch (ilabel) {
+	case 15:
+		SHIFT(5);
+		return E_OK;
+	case 29:
+		SHIFT(4);
+		return E_OK;
+	}
+	return E_SYNTAX;
+
+ state_39_4:	/* classdef */
+	switch (ilabel) {
+	case 13: case 17: case 79: case 81: case 83: case 84: case 85:
+		PUSH(296, 6);
+		goto state_40_0;
+	}
+	return E_SYNTAX;
+
+ state_39_5:	/* classdef */
+	switch (ilabel) {
+	case 2: case 13: case 17: case 30: case 32: case 33: case 37: case 38: case 39: case 41: case 42: case 72: case 73: case 79: case 81: case 83: case 84: case 85:
+		PUSH(281, 7);
+		goto state_25_0;
+	}
+	return E_SYNTAX;
+
+ state_39_6:	/* classdef */
+	switch (ilabel) {
+	case 15:
+		SHIFT(5);
+		return E_OK;
+	}
+	return E_SYNTAX;
+
+ state_39_7:	/* classdef */
+	goto popretry;
+
+ state_40_0:	/* baselist */
+	switch (ilabel) {
+	case 13: case 17: case 79: case 81: case 83: case 84: case 85:
+		PUSH(290, 1);
+		goto state_34_0;
+	}
+	return E_SYNTAX;
+
+ state_40_1:	/* baselist */
+	switch (ilabel) {
+	case 17:
+		PUSH(297, 2);
+		goto state_41_0;
+	}
+	return E_SYNTAX;
+
+ state_40_2:	/* baselist */
+	switch (ilabel) {
+	case 21:
+		SHIFT(0);
+		return E_OK;
+	}
+	goto popretry;
+
+ state_41_0:	/* arguments */
+	switch (ilabel) {
+	case 17:
+		SHIFT(1);
+		return E_OK;
+	}
+	return E_SYNTAX;
+
+ state_41_1:	/* arguments */
+	switch (ilabel) {
+	case 13: case 17: case 65: case 72: case 73: case 79: case 81: case 83: case 84: case 85:
+		PUSH(294, 2);
+		goto state_38_0;
+	case 19:
+		SHIFT(3);
+		goto popaccepted;
+	}
+	return E_SYNTAX;
+
+ state_41_2:	/* arguments */
+	switch (ilabel) {
+	case 19:
+		SHIFT(3);
+		goto popaccepted;
+	}
+	return E_SYNTAX;
+
+ state_41_3:	/* arguments */
+	goto popretry;
+
+ popretry:
+	popdfa(ps);
+	if (s_empty(&ps->p_stack))
+		return E_SYNTAX;
+	goto dispatch;
+
+ popaccepted:
+	do {
+		popdfa(ps);
+		if (s_empty(&ps->p_stack))
+			return E_DONE;
+		top = ps->p_stack.s_top;
+		s = &top->s_dfa->d_state[top->s_state];
+	} while (s->s_accept && s->s_narcs == 1);
+	return E_OK;
+}
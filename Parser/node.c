@@ -1,16 +1,116 @@
 /* Parse tree node implementation */
 
+/*
+All nodes of a parse tree, their child arrays and the token strings
+are carved out of large blocks that belong to the tree.  Nothing is
+freed individually; freetree() releases the blocks of a whole tree at
+once, which is done as soon as the tree has been compiled.
+
+The root node lives in a header that also anchors the block list, so
+the root pointer is all that is needed to allocate into or free a
+tree.
+*/
+
 #include "PROTO.h"
 #include "malloc.h"
 #include "node.h"
 
+#define BLOCKSIZE	4000	/* Bytes per block, less the header */
+
+/* Allocations are rounded up to a multiple of this */
+#define ALIGNMENT	sizeof(union align)
+#define ROUNDUP(size)	(((size) + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT)
+
+union align {
+	double	a_double;
+	long	a_long;
+	char	*a_ptr;
+};
+
+struct block {
+	struct block	*b_next;	/* Previously filled block */
+	unsigned int	b_size;		/* Bytes usable after the header */
+	unsigned int	b_used;		/* Bytes handed out so far */
+	union align	b_align;	/* Force alignment of the data */
+};
+
+#define BLOCKDATA(b)	((char *)((b) + 1))
+
+struct tree {
+	struct block	*t_block;	/* Block currently allocated from */
+	node		*t_free;	/* Recycled one-node child arrays */
+	node		t_root;
+};
+
+#define TREE(root)	((struct tree *) \
+			 ((char *)(root) - (char *)&((struct tree *)0)->t_root))
+
+static struct block *
+newblock(size, next)
+	unsigned int size;
+	struct block *next;
+{
+	struct block *b;
+	b = (struct block *) malloc(sizeof(struct block) + size);
+	if (b == NULL)
+		return NULL;
+	b->b_next = next;
+	b->b_size = size;
+	b->b_used = 0;
+	return b;
+}
+
+/* Allocate size bytes in the tree whose root is given.
+   The memory lives until the tree is freed. */
+
+char *
+treealloc(root, size)
+	node *root;
+	unsigned int size;
+{
+	register struct tree *t = TREE(root);
+	register struct block *b = t->t_block;
+	char *p;
+	size = ROUNDUP(size);
+	if (b->b_size - b->b_used < size) {
+		if (size > BLOCKSIZE/4) {
+			/* Give large requests a block of their own and
+			   keep filling the current one */
+			b = newblock(size, b->b_next);
+			if (b == NULL)
+				return NULL;
+			t->t_block->b_next = b;
+		}
+		else {
+			b = newblock(BLOCKSIZE, b);
+			if (b == NULL)
+				return NULL;
+			t->t_block = b;
+		}
+	}
+	p = BLOCKDATA(b) + b->b_used;
+	b->b_used += size;
+	return p;
+}
+
+/* Create a parse tree consisting of a root node of the given type */
+
 node *
-newnode(type)
+newtree(type)
 	int type;
 {
-	node *n = NEW(node, 1);
-	if (n == NULL)
+	struct tree *t;
+	node *n;
+	t = NEW(struct tree, 1);
+	if (t == NULL)
 		return NULL;
+	t->t_block = newblock(BLOCKSIZE, (struct block *)NULL);
+	if (t->t_block == NULL) {
+		DEL(t);
+		return NULL;
+	}
+	t->t_free = NULL;
+	n = &t->t_root;
 	n->n_type = type;
 	n->n_str = NULL;
 	n->n_nchildren = 0;
@@ -18,24 +118,52 @@ newnode(type)
 	return n;
 }
 
-#define XXX 3 /* Node alignment factor to speed up realloc */
-#define XXXROUNDUP(n) ((n) == 1 ? 1 : ((n) + XXX - 1) / XXX * XXX)
+/* Free a whole parse tree, given its root */
+
+void
+freetree(root)
+	node *root;
+{
+	struct tree *t;
+	struct block *b, *next;
+	if (root == NULL)
+		return;
+	t = TREE(root);
+	for (b = t->t_block; b != NULL; b = next) {
+		next = b->b_next;
+		free((char *)b);
+	}
+	DEL(t);
+}
+
+/* Child arrays hold a power of two nodes; a full array is copied into
+   one twice its size and the old one is abandoned until the tree is
+   freed.  The vast majority of nodes has a single child. */
+
+#define ISPOWEROF2(n) (((n) & ((n) - 1)) == 0)
 
 node *
-addchild(n1, type, str)
+addchild(root, n1, type, str)
+	node *root;
 	register node *n1;
 	int type;
 	char *str;
 {
 	register int nch = n1->n_nchildren;
-	register int nch1 = nch+1;
 	register node *n;
-	if (XXXROUNDUP(nch) < nch1) {
-		n = n1->n_child;
-		nch1 = XXXROUNDUP(nch1);
-		RESIZE(n, node, nch1);
+	if (nch == 0 && TREE(root)->t_free != NULL) {
+		n = TREE(root)->t_free;
+		TREE(root)->t_free = n->n_child;
+		n1->n_child = n;
+	}
+	else if (nch == 0 || ISPOWEROF2(nch)) {
+		int i;
+		n = (node *) treealloc(root,
+			(unsigned int) (nch == 0 ? 1 : 2*nch) * sizeof(node));
 		if (n == NULL)
 			return NULL;
+		for (i = 0; i < nch; i++)
+			n[i] = n1->n_child[i];
 		n1->n_child = n;
 	}
 	n = &n1->n_child[n1->n_nchildren++];
@@ -45,3 +173,21 @@ addchild(n1, type, str)
 	n->n_child = NULL;
 	return n;
 }
+
+/* Replace a node that has a single child by that child.  The child
+   array, now unused, is recycled by addchild.  This is how the parser
+   builds compact trees: e.g. a bare name in an expression would
+   otherwise be the bottom of a chain of eight nodes from test down
+   to atom. */
+
+void
+collapsenode(root, n)
+	node *root;
+	node *n;
+{
+	struct tree *t = TREE(root);
+	node *ch = n->n_child;
+	*n = *ch;
+	ch->n_child = t->t_free;
+	t->t_free = ch;
+}
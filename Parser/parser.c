@@ -35,8 +35,6 @@ s_reset(s)
 	s->s_top = &s->s_base[MAXSTACK];
 }
 
-#define s_empty(s) ((s)->s_top == &(s)->s_base[MAXSTACK])
-
 static int s_push PROTO((stack *, dfa *, node *));
 
 static int
@@ -94,10 +92,8 @@ newparser(g, start)
 	if (ps == NULL)
 		return NULL;
 	ps->p_grammar = g;
-	ps->p_tree = newnode(start);
+	ps->p_tree = newtree(start);
 	if (ps->p_tree == NULL) {
-		if (ps->p_tree != NULL)
-			DEL(ps->p_tree); /* XXX freeing a node!?! */
 		DEL(ps);
 		return NULL;
 	}
@@ -106,6 +102,9 @@ newparser(g, start)
 	return ps;
 }
 
+/* The tree is not freed; it is either handed to the caller or freed
+   explicitly when parsing fails */
+
 void
 delparser(ps)
 	parser_state *ps;
@@ -116,29 +115,29 @@ delparser(ps)
 
 /* PARSER STACK OPERATIONS */
 
-static int shift PROTO((stack *, int, char *, int));
+/* These are also used by the direct-coded parser */
 
-static int
-shift(s, type, str, newstate)
+int
+shifttoken(s, root, type, str, newstate)
 	register stack *s;
+	node *root;
 	int type;
 	char *str;
 	int newstate;
 {
 	assert(!s_empty(s));
-	if (addchild(s->s_top->s_parent, type, str) == NULL) {
-		fprintf(stderr, "shift: no mem in addchild\n");
+	if (addchild(root, s->s_top->s_parent, type, str) == NULL) {
+		fprintf(stderr, "shifttoken: no mem in addchild\n");
 		return -1;
 	}
 	s->s_top->s_state = newstate;
 	return 0;
 }
 
-static int push PROTO((stack *, int, dfa *, int));
-
-static int
-push(s, type, d, newstate)
+int
+pushdfa(s, root, type, d, newstate)
 	register stack *s;
+	node *root;
 	int type;
 	dfa *d;
 	int newstate;
@@ -146,14 +145,29 @@ push(s, type, d, newstate)
 	register node *n;
 	n = s->s_top->s_parent;
 	assert(!s_empty(s));
-	if (addchild(n, type, (char *)NULL) == NULL) {
-		fprintf(stderr, "push: no mem in addchild\n");
+	if (addchild(root, n, type, (char *)NULL) == NULL) {
+		fprintf(stderr, "pushdfa: no mem in addchild\n");
 		return -1;
 	}
 	s->s_top->s_state = newstate;
 	return s_push(s, d, CHILD(n, NCH(n)-1));
 }
 
+/* Pop a completed non-terminal.  If the grammar asks for compact trees,
+   a node whose only child is a non-terminal is replaced by that child;
+   the root always keeps the start symbol. */
+
+void
+popdfa(ps)
+	register parser_state *ps;
+{
+	register node *n = ps->p_stack.s_top->s_parent;
+	s_pop(&ps->p_stack);
+	if (ps->p_grammar->g_compact && n != ps->p_tree && NCH(n) == 1 &&
+					ISNONTERMINAL(TYPE(CHILD(n, 0))))
+		collapsenode(ps->p_tree, n);
+}
+
 
 /* PARSER PROPER */
 
@@ -167,6 +181,26 @@ classify(g, type, str)
 {
 	register int n = g->g_ll.ll_nlabels;
 	
+	if (g->g_toklabel != NULL) {
+		/* Use the tables written by pgen */
+		if (type == NAME && g->g_kwsize > 0) {
+			register int i = g->g_kwlabel[
+				keywordhash(str, g->g_kwmult, g->g_kwsize)];
+			if (i >= 0 &&
+				strcmp(g->g_ll.ll_label[i].lb_str, str) == 0) {
+				D(printf("It's a keyword\n"));
+				return i;
+			}
+		}
+		if (type >= 0 && type < N_TOKENS &&
+					g->g_toklabel[type] >= 0) {
+			D(printf("It's a token we know\n"));
+			return g->g_toklabel[type];
+		}
+		D(printf("Illegal token\n"));
+		return -1;
+	}
+	
 	if (type == NAME) {
 		register char *s = str;
 		register label *l = g->g_ll.ll_label;
@@ -211,6 +245,10 @@ addtoken(ps, type, str)
 	if (ilabel < 0)
 		return E_SYNTAX;
 	
+	/* Hand it to the direct-coded parser, if the grammar has one */
+	if (ps->p_grammar->g_parse != NULL)
+		return (*ps->p_grammar->g_parse)(ps, ilabel, type, str);
+	
 	/* Loop until the token is shifted or an error occurred */
 	for (;;) {
 		/* Fetch the current dfa and state */
@@ -229,7 +267,8 @@ addtoken(ps, type, str)
 					int nt = (x >> 8) + NT_OFFSET;
 					int arrow = x & ((1<<7)-1);
 					dfa *d1 = finddfa(ps->p_grammar, nt);
-					if (push(&ps->p_stack, nt, d1, arrow) < 0) {
+					if (pushdfa(&ps->p_stack, ps->p_tree,
+						nt, d1, arrow) < 0) {
 						D(printf(" MemError: push.\n"));
 						return E_NOMEM;
 					}
@@ -238,7 +277,8 @@ addtoken(ps, type, str)
 				}
 				
 				/* Shift the token */
-				if (shift(&ps->p_stack, type, str, x) < 0) {
+				if (shifttoken(&ps->p_stack, ps->p_tree,
+						type, str, x) < 0) {
 					D(printf(" MemError: shift.\n"));
 					return E_NOMEM;
 				}
@@ -248,7 +288,7 @@ addtoken(ps, type, str)
 						[ps->p_stack.s_top->s_state],
 					s->s_accept && s->s_narcs == 1) {
 					D(printf("  Direct pop.\n"));
-					s_pop(&ps->p_stack);
+					popdfa(ps);
 					if (s_empty(&ps->p_stack)) {
 						D(printf("  ACCEPT.\n"));
 						return E_DONE;
@@ -261,7 +301,7 @@ addtoken(ps, type, str)
 		
 		if (s->s_accept) {
 			/* Pop this dfa and try again */
-			s_pop(&ps->p_stack);
+			popdfa(ps);
 			D(printf(" Pop ...\n"));
 			if (s_empty(&ps->p_stack)) {
 				D(printf(" Error: bottom of stack.\n"));
@@ -14,7 +14,7 @@ typedef struct _stack {
 					/* NB The stack grows down */
 } stack;
 
-typedef struct {
+typedef struct _parser_state {
 	struct _stack	 p_stack;	/* Stack of parser states */
 	struct _grammar	*p_grammar;	/* Grammar to use */
 	struct _node	*p_tree;	/* Top of parse tree */
@@ -23,3 +23,11 @@ typedef struct {
 parser_state *newparser PROTO((struct _grammar *g, int start));
 void delparser PROTO((parser_state *ps));
 int addtoken PROTO((parser_state *ps, int type, char *str));
+
+/* For the direct-coded parser written by pgen -d */
+
+#define s_empty(s) ((s)->s_top == &(s)->s_base[MAXSTACK])
+
+int shifttoken PROTO((stack *s, node *root, int type, char *str, int newstate));
+int pushdfa PROTO((stack *s, node *root, int type, dfa *d, int newstate));
+void popdfa PROTO((parser_state *ps));
@@ -1,6 +1,7 @@
 /* Parser-tokenizer link implementation */
 
 #include <stdio.h>
+#include "string.h"
 
 #include "PROTO.h"
 #include "malloc.h"
@@ -13,18 +14,35 @@
 extern int debugging;
 
 
+/* State for parsing a file one statement at a time (see parsestmt) */
+
+struct stmtfile {
+	struct tok_state *sf_tok;
+	int	sf_type;	/* Token ending the last statement, or -1 */
+	char	*sf_str;	/* Its string */
+	int	sf_size;	/* Bytes allocated for sf_str */
+};
+
+static int savetoken PROTO((struct stmtfile *, int, char *));
+
 /* Parse input coming from the given tokenizer structure.
-   Return error code. */
+   Return error code.  Token strings are allocated in the tree;
+   if no tree is returned it has already been freed.
+   If sf is not NULL, parse one statement of a file_input: NEWLINE
+   tokens before it are skipped, ENDMARKER gives E_EOF, and the token
+   after a compound statement is saved in sf for the next call. */
 
 static int
-parsetok(tok, g, start, n_ret)
+parsetok(tok, g, start, n_ret, sf)
 	struct tok_state *tok;
 	grammar *g;
 	int start;
 	node **n_ret;
+	struct stmtfile *sf;
 {
 	parser_state *ps;
 	int ret;
+	int ntokens = 0;
 	
 	if ((ps = newparser(g, start)) == NULL) {
 		fprintf(stderr, "no mem for new parser\n");
@@ -37,13 +55,29 @@ parsetok(tok, g, start, n_ret)
 		int len;
 		char *str;
 		
-		type = tok_get(tok, &a, &b);
+		if (sf != NULL && sf->sf_type >= 0) {
+			type = sf->sf_type;
+			a = sf->sf_str;
+			b = a + strlen(a);
+			sf->sf_type = -1;
+		}
+		else
+			type = tok_get(tok, &a, &b);
 		if (type == ERRORTOKEN) {
 			ret = tok->done;
 			break;
 		}
+		if (sf != NULL && ntokens == 0) {
+			if (type == NEWLINE)
+				continue;
+			if (type == ENDMARKER) {
+				ret = E_EOF;
+				break;
+			}
+		}
+		ntokens++;
 		len = b - a;
-		str = NEW(char, len + 1);
+		str = treealloc(ps->p_tree, (unsigned int)(len + 1));
 		if (str == NULL) {
 			fprintf(stderr, "no mem for next token\n");
 			ret = E_NOMEM;
@@ -52,6 +86,11 @@ parsetok(tok, g, start, n_ret)
 		strncpy(str, a, len);
 		str[len] = '\0';
 		ret = addtoken(ps, (int)type, str);
+		if (ret == E_SYNTAX && sf != NULL && s_empty(&ps->p_stack)) {
+			/* The statement was complete and the parser popped
+			   it; the token starts the next one */
+			ret = savetoken(sf, type, str);
+		}
 		if (ret != E_OK) {
 			if (ret == E_DONE)
 				*n_ret = ps->p_tree;
@@ -61,6 +100,8 @@ parsetok(tok, g, start, n_ret)
 		}
 	}
 	
+	if (ret != E_DONE)
+		freetree(ps->p_tree);
 	delparser(ps);
 	return ret;
 }
@@ -82,7 +123,7 @@ parsestring(s, g, start, n_ret)
 		fprintf(stderr, "no mem for tok_setups\n");
 		return E_NOMEM;
 	}
-	ret = parsetok(tok, g, start, n_ret);
+	ret = parsetok(tok, g, start, n_ret, (struct stmtfile *)NULL);
 	if (ret == E_TOKEN || ret == E_SYNTAX) {
 		fprintf(stderr, "String parsing error at line %d\n",
 			tok->lineno);
@@ -92,6 +133,33 @@ parsestring(s, g, start, n_ret)
 }
 
 
+/* Print the line where a syntax error was found */
+
+static void
+printerror(tok)
+	struct tok_state *tok;
+{
+	char *p, *line, *end;
+	fprintf(stderr, "Parsing error at line %d:\n", tok->lineno);
+	/* The buffer may hold more than the offending line */
+	line = tok->cur;
+	if (line > tok->buf && line[-1] == '\n')
+		line--;
+	while (line > tok->buf && line[-1] != '\n')
+		line--;
+	for (end = line; end < tok->inp && *end != '\n'; end++)
+		;
+	fprintf(stderr, "%.*s\n", (int)(end - line), line);
+	for (p = line; p < tok->cur; p++) {
+		if (*p == '\t')
+			putc('\t', stderr);
+		else
+			putc(' ', stderr);
+	}
+	fprintf(stderr, "^\n");
+}
+
+
 /* Parse input coming from a file.  Return error code. */
 
 int
@@ -109,23 +177,81 @@ parsefile(fp, g, start, ps1, ps2, n_ret)
 		fprintf(stderr, "no mem for tok_setupf\n");
 		return E_NOMEM;
 	}
-	ret = parsetok(tok, g, start, n_ret);
-	if (ret == E_TOKEN || ret == E_SYNTAX) {
-		char *p;
-		fprintf(stderr, "Parsing error at line %d:\n",
-			tok->lineno);
-		*tok->inp = '\0';
-		if (tok->inp > tok->buf && tok->inp[-1] == '\n')
-			tok->inp[-1] = '\0';
-		fprintf(stderr, "%s\n", tok->buf);
-		for (p = tok->buf; p < tok->cur; p++) {
-			if (*p == '\t')
-				putc('\t', stderr);
-			else
-				putc(' ', stderr);
-		}
-		fprintf(stderr, "^\n");
-	}
+	ret = parsetok(tok, g, start, n_ret, (struct stmtfile *)NULL);
+	if (ret == E_TOKEN || ret == E_SYNTAX)
+		printerror(tok);
 	tok_free(tok);
 	return ret;
 }
+
+
+/* Parse a file one statement at a time.  This is for files too big
+   to hold the parse tree of all at once: each call to parsestmt()
+   returns the tree of the next statement of a file_input (start
+   should be the grammar's stmt symbol), which can be compiled,
+   executed and freed before the next one is parsed.  The file is read
+   line by line.  Returns E_DONE for a statement, E_EOF at the end of
+   the file, or an error code. */
+
+struct stmtfile *
+openstmts(fp)
+	FILE *fp;
+{
+	struct stmtfile *sf = NEW(struct stmtfile, 1);
+	if (sf == NULL)
+		return NULL;
+	if ((sf->sf_tok = tok_setupl(fp)) == NULL) {
+		DEL(sf);
+		return NULL;
+	}
+	sf->sf_type = -1;
+	sf->sf_str = NULL;
+	sf->sf_size = 0;
+	return sf;
+}
+
+int
+parsestmt(sf, g, start, n_ret)
+	struct stmtfile *sf;
+	grammar *g;
+	int start;
+	node **n_ret;
+{
+	int ret = parsetok(sf->sf_tok, g, start, n_ret, sf);
+	if (ret == E_TOKEN || ret == E_SYNTAX)
+		printerror(sf->sf_tok);
+	return ret;
+}
+
+void
+closestmts(sf)
+	struct stmtfile *sf;
+{
+	tok_free(sf->sf_tok);
+	if (sf->sf_str != NULL)
+		DEL(sf->sf_str);
+	DEL(sf);
+}
+
+/* Save a copy of the token that ended a statement, since the string
+   in its tree is freed with the tree */
+
+static int
+savetoken(sf, type, str)
+	struct stmtfile *sf;
+	int type;
+	char *str;
+{
+	int len = strlen(str);
+	if (len >= sf->sf_size) {
+		sf->sf_size = len + 1;
+		RESIZE(sf->sf_str, char, sf->sf_size);
+		if (sf->sf_str == NULL) {
+			sf->sf_size = 0;
+			return E_NOMEM;
+		}
+	}
+	strcpy(sf->sf_str, str);
+	sf->sf_type = type;
+	return E_DONE;
+}
@@ -3,6 +3,7 @@
 /* For a description, see the comments at end of this file */
 
 #include <stdio.h>
+#include <time.h>
 #include "assert.h"
 
 #include "PROTO.h"
@@ -15,6 +16,10 @@
 
 extern int debugging;
 
+#ifndef CLOCKS_PER_SEC
+#define CLOCKS_PER_SEC 1000000	/* clock() counts microseconds */
+#endif
+
 
 /* PART ONE -- CONSTRUCT NFA -- Cf. Algorithm 3.2 from [Aho&Ullman 77] */
 
@@ -391,117 +396,209 @@ typedef struct _ss_state {
 	int	ss_deleted;
 	int	ss_finish;
 	int	ss_rename;
+	unsigned long ss_hash;
+	int	ss_next;	/* Next state in the same hash bucket */
 } ss_state;
 
+/* The subsets made so far are kept in a hash table, so looking up the
+   destination of an arc doesn't compare it with every subset */
+
 typedef struct _ss_dfa {
 	int	sd_nstates;
 	ss_state *sd_state;
+	int	sd_size;	/* Number of states allocated */
+	int	sd_nbits;
+	int	sd_nbuckets;	/* Always a power of two */
+	int	*sd_bucket;	/* First state in each bucket, or -1 */
 } ss_dfa;
 
-static
+#define ISPOWEROF2(n) (((n) & ((n) - 1)) == 0)
+
+static void
+rehash(sd, nbuckets)
+	ss_dfa *sd;
+	int nbuckets;
+{
+	int i, h;
+	
+	RESIZE(sd->sd_bucket, int, nbuckets);
+	if (sd->sd_bucket == NULL)
+		fatal("out of mem");
+	sd->sd_nbuckets = nbuckets;
+	for (i = 0; i < nbuckets; i++)
+		sd->sd_bucket[i] = -1;
+	for (i = 0; i < sd->sd_nstates; i++) {
+		h = sd->sd_state[i].ss_hash & (nbuckets - 1);
+		sd->sd_state[i].ss_next = sd->sd_bucket[h];
+		sd->sd_bucket[h] = i;
+	}
+}
+
+/* Return the index of the state for subset ss, or -1 */
+
+static int
+findsubset(sd, ss, hash)
+	ss_dfa *sd;
+	bitset ss;
+	unsigned long hash;
+{
+	int i;
+	
+	for (i = sd->sd_bucket[hash & (sd->sd_nbuckets - 1)]; i >= 0;
+					i = sd->sd_state[i].ss_next) {
+		if (sd->sd_state[i].ss_hash == hash &&
+			samebitset(sd->sd_state[i].ss_ss, ss, sd->sd_nbits))
+			return i;
+	}
+	return -1;
+}
+
+static int
+addsubset(sd, ss, hash, finish)
+	ss_dfa *sd;
+	bitset ss;
+	unsigned long hash;
+	int finish;
+{
+	ss_state *yy;
+	int h;
+	
+	if (sd->sd_nstates >= sd->sd_size) {
+		sd->sd_size *= 2;
+		RESIZE(sd->sd_state, ss_state, sd->sd_size);
+		if (sd->sd_state == NULL)
+			fatal("out of mem");
+	}
+	yy = &sd->sd_state[sd->sd_nstates];
+	yy->ss_ss = ss;
+	yy->ss_narcs = 0;
+	yy->ss_arc = NULL;
+	yy->ss_deleted = 0;
+	yy->ss_finish = finish;
+	yy->ss_hash = hash;
+	h = hash & (sd->sd_nbuckets - 1);
+	yy->ss_next = sd->sd_bucket[h];
+	sd->sd_bucket[h] = sd->sd_nstates;
+	if (++sd->sd_nstates >= sd->sd_nbuckets)
+		rehash(sd, 2 * sd->sd_nbuckets);
+	return sd->sd_nstates - 1;
+}
+
+/* Returns the number of subsets constructed, before minimizing */
+
+static int
 makedfa(gr, nf, d)
 	nfagrammar *gr;
 	nfa *nf;
 	dfa *d;
 {
 	int nbits = nf->nf_nstates;
+	int nlabels = gr->gr_ll.ll_nlabels;
 	bitset ss;
-	int xx_nstates;
-	ss_state *xx_state, *yy;
+	ss_dfa sd;
+	ss_state *yy;
 	ss_arc *zz;
+	int *arcof;
 	int istate, jstate, iarc, jarc, ibit;
+	unsigned long hash;
 	nfastate *st;
 	nfaarc *ar;
 	
+	sd.sd_nstates = 0;
+	sd.sd_size = 8;
+	sd.sd_state = NEW(ss_state, sd.sd_size);
+	sd.sd_nbits = nbits;
+	sd.sd_bucket = NULL;
+	arcof = NEW(int, nlabels);
+	if (sd.sd_state == NULL || arcof == NULL)
+		fatal("no mem for subsets in makedfa");
+	rehash(&sd, 16);
+	for (iarc = 0; iarc < nlabels; iarc++)
+		arcof[iarc] = -1;
+	
 	ss = newbitset(nbits);
 	addclosure(ss, nf, nf->nf_start);
-	xx_state = NEW(ss_state, 1);
-	if (xx_state == NULL)
-		fatal("no mem for xx_state in makedfa");
-	xx_nstates = 1;
-	yy = &xx_state[0];
-	yy->ss_ss = ss;
-	yy->ss_narcs = 0;
-	yy->ss_arc = NULL;
-	yy->ss_deleted = 0;
-	yy->ss_finish = testbit(ss, nf->nf_finish);
-	if (yy->ss_finish)
+	addsubset(&sd, ss, hashbitset(ss, nbits),
+		testbit(ss, nf->nf_finish));
+	if (sd.sd_state[0].ss_finish)
 		printf("Error: nonterminal '%s' may produce empty.\n",
 			nf->nf_name);
 	
-	/* This algorithm is from a book written before
-	   the invention of structured programming... */
-
 	/* For each unmarked state... */
-	for (istate = 0; istate < xx_nstates; ++istate) {
-		yy = &xx_state[istate];
+	for (istate = 0; istate < sd.sd_nstates; ++istate) {
+		yy = &sd.sd_state[istate];
 		ss = yy->ss_ss;
 		/* For all its states... */
-		for (ibit = 0; ibit < nf->nf_nstates; ++ibit) {
-			if (!testbit(ss, ibit))
-				continue;
+		for (ibit = nextbit(ss, 0, nbits); ibit >= 0;
+					ibit = nextbit(ss, ibit + 1, nbits)) {
 			st = &nf->nf_state[ibit];
 			/* For all non-empty arcs from this state... */
 			for (iarc = 0; iarc < st->st_narcs; iarc++) {
 				ar = &st->st_arc[iarc];
 				if (ar->ar_label == EMPTY)
 					continue;
-				/* Look up in list of arcs from this state */
-				for (jarc = 0; jarc < yy->ss_narcs; ++jarc) {
+				/* Find or add the arc for this label */
+				jarc = arcof[ar->ar_label];
+				if (jarc < 0) {
+					if (ISPOWEROF2(yy->ss_narcs)) {
+						RESIZE(yy->ss_arc, ss_arc,
+						       yy->ss_narcs == 0 ?
+						       1 : 2 * yy->ss_narcs);
+						if (yy->ss_arc == NULL)
+							fatal("out of mem");
+					}
+					jarc = arcof[ar->ar_label] =
+						yy->ss_narcs++;
 					zz = &yy->ss_arc[jarc];
-					if (ar->ar_label == zz->sa_label)
-						goto found;
+					zz->sa_label = ar->ar_label;
+					zz->sa_bitset = newbitset(nbits);
+					zz->sa_arrow = -1;
 				}
-				/* Add new arc for this state */
-				RESIZE(yy->ss_arc, ss_arc, yy->ss_narcs + 1);
-				if (yy->ss_arc == NULL)
-					fatal("out of mem");
-				zz = &yy->ss_arc[yy->ss_narcs++];
-				zz->sa_label = ar->ar_label;
-				zz->sa_bitset = newbitset(nbits);
-				zz->sa_arrow = -1;
-			 found:	;
 				/* Add destination */
-				addclosure(zz->sa_bitset, nf, ar->ar_arrow);
+				addclosure(yy->ss_arc[jarc].sa_bitset,
+					nf, ar->ar_arrow);
 			}
 		}
-		/* Now look up all the arrow states */
-		for (jarc = 0; jarc < xx_state[istate].ss_narcs; jarc++) {
-			zz = &xx_state[istate].ss_arc[jarc];
-			for (jstate = 0; jstate < xx_nstates; jstate++) {
-				if (samebitset(zz->sa_bitset,
-					xx_state[jstate].ss_ss, nbits)) {
-					zz->sa_arrow = jstate;
-					goto done;
-				}
+		/* Now look up all the arrow states; adding a subset
+		   may move the state array */
+		for (jarc = 0; jarc < sd.sd_state[istate].ss_narcs; jarc++) {
+			zz = &sd.sd_state[istate].ss_arc[jarc];
+			arcof[zz->sa_label] = -1;
+			ss = zz->sa_bitset;
+			hash = hashbitset(ss, nbits);
+			jstate = findsubset(&sd, ss, hash);
+			if (jstate >= 0) {
+				delbitset(ss);
+				zz->sa_bitset = sd.sd_state[jstate].ss_ss;
 			}
-			RESIZE(xx_state, ss_state, xx_nstates + 1);
-			if (xx_state == NULL)
-				fatal("out of mem");
-			zz->sa_arrow = xx_nstates;
-			yy = &xx_state[xx_nstates++];
-			yy->ss_ss = zz->sa_bitset;
-			yy->ss_narcs = 0;
-			yy->ss_arc = NULL;
-			yy->ss_deleted = 0;
-			yy->ss_finish = testbit(yy->ss_ss, nf->nf_finish);
-		 done:	;
+			else
+				jstate = addsubset(&sd, ss, hash,
+					testbit(ss, nf->nf_finish));
+			sd.sd_state[istate].ss_arc[jarc].sa_arrow = jstate;
 		}
 	}
 	
 	if (debugging)
-		printssdfa(xx_nstates, xx_state, nbits, &gr->gr_ll,
+		printssdfa(sd.sd_nstates, sd.sd_state, nbits, &gr->gr_ll,
 						"before minimizing");
 	
-	simplify(xx_nstates, xx_state);
+	minimize(sd.sd_nstates, sd.sd_state, nlabels);
 	
 	if (debugging)
-		printssdfa(xx_nstates, xx_state, nbits, &gr->gr_ll,
+		printssdfa(sd.sd_nstates, sd.sd_state, nbits, &gr->gr_ll,
 						"after minimizing");
 	
-	convert(d, xx_nstates, xx_state);
+	convert(d, sd.sd_nstates, sd.sd_state);
 	
-	/* XXX cleanup */
+	for (istate = 0; istate < sd.sd_nstates; istate++) {
+		delbitset(sd.sd_state[istate].ss_ss);
+		if (sd.sd_state[istate].ss_arc != NULL)
+			DEL(sd.sd_state[istate].ss_arc);
+	}
+	DEL(sd.sd_state);
+	DEL(sd.sd_bucket);
+	DEL(arcof);
+	return sd.sd_nstates;
 }
 
 static
@@ -540,76 +637,229 @@ printssdfa(xx_nstates, xx_state, nbits, ll, msg)
 }
 
 
-/* PART THREE -- SIMPLIFY DFA */
+/* PART THREE -- MINIMIZE DFA */
 
-/* Simplify the DFA by repeatedly eliminating states that are
-   equivalent to another oner.  This is NOT Algorithm 3.3 from
-   [Aho&Ullman 77].  It does not always finds the minimal DFA,
-   but it does usually make a much smaller one...  (For an example
-   of sub-optimal behaviour, try S: x a b+ | y a b+.)
+/* Minimize the DFA by Hopcroft's partition refinement algorithm.
+   Missing arcs go to an extra dead state.  The states start out in
+   two blocks, finish and non-finish; a block is split whenever some
+   of its states, but not all, have an arc with a given label into a
+   splitter block.  Of the two halves of a split only the smaller
+   needs to become a splitter, which makes this O(n log n) per label.
+   Afterwards all states in a block are equivalent; the one with the
+   lowest number is kept (so the initial state stays state 0) and the
+   others are deleted.
 */
 
-static int
-samestate(s1, s2)
-	ss_state *s1, *s2;
-{
-	int i;
-	
-	if (s1->ss_narcs != s2->ss_narcs || s1->ss_finish != s2->ss_finish)
-		return 0;
-	for (i = 0; i < s1->ss_narcs; i++) {
-		if (s1->ss_arc[i].sa_arrow != s2->ss_arc[i].sa_arrow ||
-			s1->ss_arc[i].sa_label != s2->ss_arc[i].sa_label)
-			return 0;
-	}
-	return 1;
-}
-
 static void
-renamestates(xx_nstates, xx_state, from, to)
-	int xx_nstates;
+minimize(n, xx_state, nlabels)
+	int n;			/* Number of states; n is the dead state */
 	ss_state *xx_state;
-	int from, to;
+	int nlabels;
 {
-	int i, j;
+	int *lmap;		/* Label -> index among the used labels */
+	int nused;
+	int *invstart, *inv;	/* Sources of arcs into state, by label */
+	int *elems, *loc, *blk;	/* The partition; blocks are contiguous */
+	int *first, *last, *marked;
+	int *work, *inwork, nwork;
+	int *touched, ntouched;
+	int *splitter, nsplit;
+	int *rep;
+	int *dest, *count;
+	int nblocks;
+	int i, j, k, a, b, nb, p, q, pass;
+	ss_arc *zz;
 	
-	if (debugging)
-		printf("Rename state %d to %d.\n", from, to);
-	for (i = 0; i < xx_nstates; i++) {
-		if (xx_state[i].ss_deleted)
-			continue;
+	lmap = NEW(int, nlabels);
+	invstart = NEW(int, n + 2);
+	elems = NEW(int, n + 1);
+	loc = NEW(int, n + 1);
+	blk = NEW(int, n + 1);
+	first = NEW(int, n + 1);
+	last = NEW(int, n + 1);
+	marked = NEW(int, n + 1);
+	work = NEW(int, n + 1);
+	inwork = NEW(int, n + 1);
+	touched = NEW(int, n + 1);
+	splitter = NEW(int, n + 1);
+	rep = NEW(int, n + 1);
+	if (lmap == NULL || invstart == NULL || elems == NULL ||
+		loc == NULL || blk == NULL || first == NULL || last == NULL ||
+		marked == NULL || work == NULL || inwork == NULL ||
+		touched == NULL || splitter == NULL || rep == NULL)
+		fatal("no mem in minimize");
+	
+	/* Number the labels that occur */
+	for (i = 0; i < nlabels; i++)
+		lmap[i] = -1;
+	nused = 0;
+	for (i = 0; i < n; i++) {
 		for (j = 0; j < xx_state[i].ss_narcs; j++) {
-			if (xx_state[i].ss_arc[j].sa_arrow == from)
-				xx_state[i].ss_arc[j].sa_arrow = to;
+			zz = &xx_state[i].ss_arc[j];
+			if (lmap[zz->sa_label] < 0)
+				lmap[zz->sa_label] = nused++;
 		}
 	}
-}
-
-static
-simplify(xx_nstates, xx_state)
-	int xx_nstates;
-	ss_state *xx_state;
-{
-	int changes;
-	int i, j, k;
-	
-	do {
-		changes = 0;
-		for (i = 1; i < xx_nstates; i++) {
-			if (xx_state[i].ss_deleted)
-				continue;
-			for (j = 0; j < i; j++) {
-				if (xx_state[j].ss_deleted)
+	
+	/* Build the inverse arcs, indexed by (label, destination); a state
+	   lacking an arc for a label gets one to the dead state */
+	dest = NEW(int, nused + 1);
+	RESIZE(invstart, int, nused * (n + 1) + 1);
+	inv = NEW(int, nused * (n + 1) + 1);
+	if (dest == NULL || invstart == NULL || inv == NULL)
+		fatal("no mem in minimize");
+	for (i = 0; i <= nused * (n + 1); i++)
+		invstart[i] = 0;
+	for (pass = 0; pass < 2; pass++) {
+		for (p = 0; p <= n; p++) {
+			for (a = 0; a < nused; a++)
+				dest[a] = n;
+			for (j = 0; p < n && j < xx_state[p].ss_narcs; j++) {
+				zz = &xx_state[p].ss_arc[j];
+				dest[lmap[zz->sa_label]] = zz->sa_arrow;
+			}
+			for (a = 0; a < nused; a++) {
+				q = a * (n + 1) + dest[a];
+				if (pass == 0)
+					invstart[q + 1]++;
+				else
+					inv[invstart[q] + --count[q]] = p;
+			}
+		}
+		if (pass == 0) {
+			/* Turn the counts into offsets */
+			count = NEW(int, nused * (n + 1) + 1);
+			if (count == NULL)
+				fatal("no mem in minimize");
+			for (i = 0; i < nused * (n + 1); i++) {
+				count[i] = invstart[i + 1];
+				invstart[i + 1] += invstart[i];
+			}
+		}
+	}
+	DEL(count);
+	DEL(dest);
+	
+	/* Initial partition: finish states first, then the rest */
+	k = 0;
+	for (p = 0; p < n; p++) {
+		if (xx_state[p].ss_finish)
+			elems[k++] = p;
+	}
+	j = k;
+	for (p = 0; p <= n; p++) {
+		if (p == n || !xx_state[p].ss_finish)
+			elems[k++] = p;
+	}
+	nblocks = 0;
+	nwork = 0;
+	if (j > 0) {
+		first[nblocks] = 0;
+		last[nblocks] = j;
+		nblocks++;
+	}
+	first[nblocks] = j;
+	last[nblocks] = n + 1;
+	nblocks++;
+	for (b = 0; b < nblocks; b++) {
+		for (i = first[b]; i < last[b]; i++) {
+			loc[elems[i]] = i;
+			blk[elems[i]] = b;
+		}
+		marked[b] = 0;
+		inwork[b] = 1;
+		work[nwork++] = b;
+	}
+	
+	while (nwork > 0) {
+		b = work[--nwork];
+		inwork[b] = 0;
+		nsplit = 0;
+		for (i = first[b]; i < last[b]; i++)
+			splitter[nsplit++] = elems[i];
+		for (a = 0; a < nused; a++) {
+			/* Mark the predecessors, moving them to the front
+			   of their blocks */
+			ntouched = 0;
+			for (i = 0; i < nsplit; i++) {
+				q = a * (n + 1) + splitter[i];
+				for (j = invstart[q]; j < invstart[q+1]; j++) {
+					p = inv[j];
+					nb = blk[p];
+					k = first[nb] + marked[nb];
+					if (loc[p] < k)
+						continue;
+					elems[loc[p]] = elems[k];
+					loc[elems[k]] = loc[p];
+					elems[k] = p;
+					loc[p] = k;
+					if (marked[nb]++ == 0)
+						touched[ntouched++] = nb;
+				}
+			}
+			/* Split the blocks that were partly marked */
+			for (i = 0; i < ntouched; i++) {
+				k = touched[i];
+				if (first[k] + marked[k] == last[k]) {
+					marked[k] = 0;
 					continue;
-				if (samestate(&xx_state[i], &xx_state[j])) {
-					xx_state[i].ss_deleted++;
-					renamestates(xx_nstates, xx_state, i, j);
-					changes++;
-					break;
+				}
+				nb = nblocks++;
+				first[nb] = first[k];
+				last[nb] = first[k] + marked[k];
+				first[k] = last[nb];
+				marked[k] = marked[nb] = 0;
+				for (j = first[nb]; j < last[nb]; j++)
+					blk[elems[j]] = nb;
+				if (inwork[k] || last[nb] - first[nb] <=
+						last[k] - first[k]) {
+					inwork[nb] = 1;
+					work[nwork++] = nb;
+				}
+				else {
+					inwork[k] = 1;
+					work[nwork++] = k;
+					inwork[nb] = 0;
 				}
 			}
 		}
-	} while (changes);
+	}
+	
+	/* Keep the lowest numbered state of each block */
+	for (b = 0; b < nblocks; b++)
+		rep[b] = n;
+	for (p = 0; p < n; p++) {
+		if (p < rep[blk[p]])
+			rep[blk[p]] = p;
+	}
+	for (p = 0; p < n; p++) {
+		if (rep[blk[p]] != p) {
+			if (debugging)
+				printf("Rename state %d to %d.\n",
+					p, rep[blk[p]]);
+			xx_state[p].ss_deleted++;
+			continue;
+		}
+		for (j = 0; j < xx_state[p].ss_narcs; j++) {
+			zz = &xx_state[p].ss_arc[j];
+			zz->sa_arrow = rep[blk[zz->sa_arrow]];
+		}
+	}
+	
+	DEL(lmap);
+	DEL(invstart);
+	DEL(inv);
+	DEL(elems);
+	DEL(loc);
+	DEL(blk);
+	DEL(first);
+	DEL(last);
+	DEL(marked);
+	DEL(work);
+	DEL(inwork);
+	DEL(touched);
+	DEL(splitter);
+	DEL(rep);
 }
 
 
@@ -654,6 +904,9 @@ convert(d, xx_nstates, xx_state)
 
 /* PART FIVE -- GLUE IT ALL TOGETHER */
 
+/* Make a DFA for each rule, reporting the work done for each, since
+   the subset construction may blow up on some rules */
+
 static grammar *
 maketables(gr)
 	nfagrammar *gr;
@@ -662,6 +915,8 @@ maketables(gr)
 	nfa *nf;
 	dfa *d;
 	grammar *g;
+	int nsubsets;
+	long t0, t1, total;
 	
 	if (gr->gr_nnfas == 0)
 		return NULL;
@@ -669,16 +924,26 @@ maketables(gr)
 			/* XXX first rule must be start rule */
 	g->g_ll = gr->gr_ll;
 	
+	total = 0;
+	printf("%-20s %6s %8s %6s %8s\n",
+		"Nonterminal", "NFA", "Subsets", "DFA", "Seconds");
 	for (i = 0; i < gr->gr_nnfas; i++) {
 		nf = gr->gr_nfa[i];
 		if (debugging) {
 			printf("Dump of NFA for '%s' ...\n", nf->nf_name);
 			dumpnfa(&gr->gr_ll, nf);
 		}
-		printf("Making DFA for '%s' ...\n", nf->nf_name);
 		d = adddfa(g, nf->nf_type, nf->nf_name);
-		makedfa(gr, gr->gr_nfa[i], d);
+		t0 = clock();
+		nsubsets = makedfa(gr, gr->gr_nfa[i], d);
+		t1 = clock();
+		total += t1 - t0;
+		printf("%-20s %6d %8d %6d %8.3f\n",
+			nf->nf_name, nf->nf_nstates, nsubsets, d->d_nstates,
+			(double)(t1 - t0) / CLOCKS_PER_SEC);
 	}
+	printf("%-20s %6s %8s %6s %8.3f\n", "Total", "", "", "",
+		(double)total / CLOCKS_PER_SEC);
 	
 	return g;
 }
@@ -711,9 +976,9 @@ tree.
 Each rule is considered as a regular expression in its own right.
 It is turned into a Non-deterministic Finite Automaton (NFA), which
 is then turned into a Deterministic Finite Automaton (DFA), which is then
-optimized to reduce the number of states.  See [Aho&Ullman 77] chapter 3,
-or similar compiler books (this technique is more often used for lexical
-analyzers).
+minimized (by Hopcroft's algorithm) to reduce the number of states.
+See [Aho&Ullman 77] chapter 3, or similar compiler books (this
+technique is more often used for lexical analyzers).
 
 The DFA's are used by the parser as parsing tables in a special way
 that's probably unique.  Before they are usable, the FIRST sets of all
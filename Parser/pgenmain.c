@@ -1,6 +1,7 @@
 /* Parser generator main program */
 
 #include <stdio.h>
+#include "string.h"
 
 #include "PROTO.h"
 #include "grammar.h"
@@ -66,12 +67,18 @@ main(argc, argv)
 	node *n;
 	FILE *fp;
 	char *filename;
+	int direct = 0;
 	
 #ifdef THINK_C
 	filename = askfile();
 #else
+	if (argc == 3 && strcmp(argv[1], "-d") == 0) {
+		direct = 1;
+		argv++;
+		argc--;
+	}
 	if (argc != 2) {
-		fprintf(stderr, "usage: %s grammar\n", argv[0]);
+		fprintf(stderr, "usage: %s [-d] grammar\n", argv[0]);
 		exit(2);
 	}
 	filename = argv[1];
@@ -93,6 +100,17 @@ main(argc, argv)
 	printf("Writing graminit.h ...\n");
 	printnonterminals(g, fp);
 	fclose(fp);
+	if (direct) {
+		/* Also write the grammar as a direct-coded parser */
+		fp = fopen("gramparse.c", "w");
+		if (fp == NULL) {
+			perror("gramparse.c");
+			exit(1);
+		}
+		printf("Writing gramparse.c ...\n");
+		printparser(g, fp);
+		fclose(fp);
+	}
 	exit(0);
 }
 
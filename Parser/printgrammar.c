@@ -4,6 +4,8 @@
 
 #include "PROTO.h"
 #include "grammar.h"
+#include "token.h"
+#include "malloc.h"
 
 static void
 printarcs(i, d, fp)
@@ -26,6 +28,28 @@ printarcs(i, d, fp)
 	}
 }
 
+static void
+printaccels(i, d, fp)
+	int i;
+	dfa *d;
+	FILE *fp;
+{
+	state *s;
+	int j, k;
+	
+	s = d->d_state;
+	for (j = 0; j < d->d_nstates; j++, s++) {
+		if (s->s_accel == NULL)
+			continue;
+		fprintf(fp, "static const short accel_%d_%d[%d] = {",
+			i, j, s->s_upper - s->s_lower);
+		for (k = 0; k < s->s_upper - s->s_lower; k++)
+			fprintf(fp, "%s%d,", k%8 == 0 ? "\n\t" : " ",
+				s->s_accel[k]);
+		fprintf(fp, "\n};\n");
+	}
+}
+
 static void
 printstates(g, fp)
 	grammar *g;
@@ -38,12 +62,20 @@ printstates(g, fp)
 	d = g->g_dfa;
 	for (i = 0; i < g->g_ndfas; i++, d++) {
 		printarcs(i, d, fp);
+		printaccels(i, d, fp);
 		fprintf(fp, "static state states_%d[%d] = {\n",
 			i, d->d_nstates);
 		s = d->d_state;
-		for (j = 0; j < d->d_nstates; j++, s++)
-			fprintf(fp, "\t{%d, arcs_%d_%d},\n",
+		for (j = 0; j < d->d_nstates; j++, s++) {
+			fprintf(fp, "\t{%d, arcs_%d_%d, ",
 				s->s_narcs, i, j);
+			if (s->s_accel == NULL)
+				fprintf(fp, "0, 0, 0, ");
+			else
+				fprintf(fp, "%d, %d, accel_%d_%d, ",
+					s->s_lower, s->s_upper, i, j);
+			fprintf(fp, "%d},\n", s->s_accept);
+		}
 		fprintf(fp, "};\n");
 	}
 }
@@ -90,6 +122,96 @@ printlabels(g, fp)
 	fprintf(fp, "};\n");
 }
 
+/* Find a hash table size and multiplier for which keywordhash() maps
+   all keywords to different slots, and print the table */
+
+#define MAXMULT 128
+#define MAXKWFACTOR 8	/* Give up at this many slots per keyword */
+
+static int
+trykeywords(g, mult, size, table)
+	grammar *g;
+	int mult, size;
+	short *table;
+{
+	label *l;
+	int i, h;
+	for (i = 0; i < size; i++)
+		table[i] = -1;
+	l = g->g_ll.ll_label;
+	for (i = 0; i < g->g_ll.ll_nlabels; i++, l++) {
+		if (l->lb_type == NAME && l->lb_str != NULL) {
+			h = keywordhash(l->lb_str, mult, size);
+			if (table[h] != -1)
+				return 0;
+			table[h] = i;
+		}
+	}
+	return 1;
+}
+
+static void
+printkeywords(g, fp)
+	grammar *g;
+	FILE *fp;
+{
+	label *l;
+	short *table;
+	int i, nkw, size, mult;
+	nkw = 0;
+	l = g->g_ll.ll_label;
+	for (i = g->g_ll.ll_nlabels; --i >= 0; l++) {
+		if (l->lb_type == NAME && l->lb_str != NULL)
+			nkw++;
+	}
+	/* Grow the table until some multiplier separates all keywords;
+	   the 23 keywords of the Python grammar need 58 slots */
+	for (size = nkw > 0 ? nkw : 1; ; size++) {
+		if (size > MAXKWFACTOR * (nkw + 1))
+			fatal("can't find a keyword hash table size");
+		table = NEW(short, size);
+		if (table == NULL)
+			fatal("no mem for keyword table");
+		for (mult = 1; mult < MAXMULT; mult++) {
+			if (trykeywords(g, mult, size, table))
+				break;
+		}
+		if (mult < MAXMULT)
+			break;
+		DEL(table);
+	}
+	g->g_kwsize = size;
+	g->g_kwmult = mult;
+	fprintf(fp, "static short kwlabels[%d] = {", size);
+	for (i = 0; i < size; i++)
+		fprintf(fp, "%s%d,", i%16 == 0 ? "\n\t" : " ", table[i]);
+	fprintf(fp, "\n};\n");
+	DEL(table);
+}
+
+/* Print the label of each token type that isn't a keyword */
+
+static void
+printtokenlabels(g, fp)
+	grammar *g;
+	FILE *fp;
+{
+	label *l;
+	int type, i;
+	fprintf(fp, "static short toklabels[%d] = {", N_TOKENS);
+	for (type = 0; type < N_TOKENS; type++) {
+		l = g->g_ll.ll_label;
+		for (i = 0; i < g->g_ll.ll_nlabels; i++, l++) {
+			if (l->lb_type == type && l->lb_str == NULL)
+				break;
+		}
+		if (i == g->g_ll.ll_nlabels)
+			i = -1;
+		fprintf(fp, "%s%d,", type%16 == 0 ? "\n\t" : " ", i);
+	}
+	fprintf(fp, "\n};\n");
+}
+
 void
 printgrammar(g, fp)
 	grammar *g;
@@ -97,13 +219,33 @@ printgrammar(g, fp)
 {
 	fprintf(fp, "#include \"PROTO.h\"\n");
 	fprintf(fp, "#include \"grammar.h\"\n");
+	if (!g->g_accel)
+		addaccelerators(g);
 	printdfas(g, fp);
 	printlabels(g, fp);
+	printkeywords(g, fp);
+	printtokenlabels(g, fp);
+	fprintf(fp, "#ifdef DIRECT_PARSER\n");
+	fprintf(fp, "extern int gramparse();\n");
+	fprintf(fp, "#endif\n");
 	fprintf(fp, "grammar gram = {\n");
 	fprintf(fp, "\t%d,\n", g->g_ndfas);
 	fprintf(fp, "\tdfas,\n");
 	fprintf(fp, "\t{%d, labels},\n", g->g_ll.ll_nlabels);
-	fprintf(fp, "\t%d\n", g->g_start);
+	fprintf(fp, "\t%d,\n", g->g_start);
+	fprintf(fp, "\t1,\n");
+	/* The compiler wants compact parse trees (see parser.c) */
+	fprintf(fp, "\t1,\n");
+	fprintf(fp, "\t%d,\n", g->g_kwsize);
+	fprintf(fp, "\t%d,\n", g->g_kwmult);
+	fprintf(fp, "\tkwlabels,\n");
+	fprintf(fp, "\ttoklabels,\n");
+	/* See printparser() */
+	fprintf(fp, "#ifdef DIRECT_PARSER\n");
+	fprintf(fp, "\tgramparse\n");
+	fprintf(fp, "#else\n");
+	fprintf(fp, "\t0\n");
+	fprintf(fp, "#endif\n");
 	fprintf(fp, "};\n");
 }
 
@@ -119,3 +261,145 @@ printnonterminals(g, fp)
 	for (i = g->g_ndfas; --i >= 0; d++)
 		fprintf(fp, "#define %s %d\n", d->d_name, d->d_type);
 }
+
+/* Print a parser for the grammar in which the accelerators are turned
+   into code.  Each state of each DFA becomes a labeled block switching
+   on the token's label; shifting a token returns to addtoken(), while
+   pushing a non-terminal jumps straight to the block for the initial
+   state of its DFA.  Only when a DFA is popped is the state looked up
+   from the parser stack, which is kept exactly as addtoken() does.
+   The output is written to gramparse.c; compiling graminit.c with
+   -DDIRECT_PARSER makes the grammar use it. */
+
+static void
+printstatecode(i, j, d, fp)
+	int i, j;
+	dfa *d;
+	FILE *fp;
+{
+	state *s = &d->d_state[j];
+	state *s1;
+	int k, m, x, arrow;
+	
+	fprintf(fp, "\n state_%d_%d:\t/* %s */\n", i, j, d->d_name);
+	if (s->s_lower < s->s_upper) {
+		fprintf(fp, "\tswitch (ilabel) {\n");
+		for (k = 0; k < s->s_upper - s->s_lower; k++) {
+			x = s->s_accel[k];
+			if (x == -1)
+				continue;
+			/* Only the first label with this action prints it */
+			for (m = 0; m < k && s->s_accel[m] != x; m++)
+				;
+			if (m < k)
+				continue;
+			fprintf(fp, "\tcase %d:", k + s->s_lower);
+			for (m = k+1; m < s->s_upper - s->s_lower; m++) {
+				if (s->s_accel[m] == x)
+					fprintf(fp, " case %d:", m + s->s_lower);
+			}
+			fprintf(fp, "\n");
+			arrow = x & ((1<<7)-1);
+			if (x & (1<<7)) {
+				fprintf(fp, "\t\tPUSH(%d, %d);\n",
+					(x >> 8) + NT_OFFSET, arrow);
+				fprintf(fp, "\t\tgoto state_%d_0;\n", x >> 8);
+			}
+			else {
+				fprintf(fp, "\t\tSHIFT(%d);\n", arrow);
+				s1 = &d->d_state[arrow];
+				if (s1->s_accept && s1->s_narcs == 1)
+					fprintf(fp, "\t\tgoto popaccepted;\n");
+				else
+					fprintf(fp, "\t\treturn E_OK;\n");
+			}
+		}
+		fprintf(fp, "\t}\n");
+	}
+	if (s->s_accept)
+		fprintf(fp, "\tgoto popretry;\n");
+	else
+		fprintf(fp, "\treturn E_SYNTAX;\n");
+}
+
+void
+printparser(g, fp)
+	grammar *g;
+	FILE *fp;
+{
+	dfa *d;
+	int i, j;
+	
+	if (!g->g_accel)
+		addaccelerators(g);
+	fprintf(fp, "/* Direct-coded parser, written by pgen -d -- ");
+	fprintf(fp, "don't edit */\n\n");
+	fprintf(fp, "#include \"PROTO.h\"\n");
+	fprintf(fp, "#include \"grammar.h\"\n");
+	fprintf(fp, "#include \"token.h\"\n");
+	fprintf(fp, "#include \"node.h\"\n");
+	fprintf(fp, "#include \"parser.h\"\n");
+	fprintf(fp, "#include \"errcode.h\"\n\n");
+	fprintf(fp, "#define SHIFT(arrow) \\\n");
+	fprintf(fp, "\tif (shifttoken(&ps->p_stack, ps->p_tree, ");
+	fprintf(fp, "type, str, arrow) < 0) \\\n");
+	fprintf(fp, "\t\treturn E_NOMEM\n");
+	fprintf(fp, "#define PUSH(nt, arrow) \\\n");
+	fprintf(fp, "\tif (pushdfa(&ps->p_stack, ps->p_tree, nt, \\\n");
+	fprintf(fp, "\t\t&ps->p_grammar->g_dfa[(nt) - NT_OFFSET], ");
+	fprintf(fp, "arrow) < 0) \\\n");
+	fprintf(fp, "\t\treturn E_NOMEM\n\n");
+	fprintf(fp, "int\n");
+	fprintf(fp, "gramparse(ps, ilabel, type, str)\n");
+	fprintf(fp, "\tregister parser_state *ps;\n");
+	fprintf(fp, "\tregister int ilabel;\n");
+	fprintf(fp, "\tint type;\n");
+	fprintf(fp, "\tchar *str;\n");
+	fprintf(fp, "{\n");
+	fprintf(fp, "\tregister stackentry *top;\n");
+	fprintf(fp, "\tregister state *s;\n");
+	
+	/* Dispatch on the state at the top of the stack */
+	fprintf(fp, "\n dispatch:\n");
+	fprintf(fp, "\ttop = ps->p_stack.s_top;\n");
+	fprintf(fp, "\tswitch (top->s_dfa->d_type) {\n");
+	d = g->g_dfa;
+	for (i = 0; i < g->g_ndfas; i++, d++) {
+		if (d->d_type != NT_OFFSET + i || d->d_initial != 0)
+			fatal("printparser: DFAs out of order");
+		fprintf(fp, "\tcase %d:\n", d->d_type);
+		fprintf(fp, "\t\tswitch (top->s_state) {\n");
+		for (j = 0; j < d->d_nstates; j++)
+			fprintf(fp, "\t\tcase %d: goto state_%d_%d;\n",
+				j, i, j);
+		fprintf(fp, "\t\t}\n");
+		fprintf(fp, "\t\tbreak;\n");
+	}
+	fprintf(fp, "\t}\n");
+	fprintf(fp, "\treturn E_SYNTAX;\n");
+	
+	d = g->g_dfa;
+	for (i = 0; i < g->g_ndfas; i++, d++) {
+		for (j = 0; j < d->d_nstates; j++)
+			printstatecode(i, j, d, fp);
+	}
+	
+	/* Pop a DFA that can't take the token and try its parent */
+	fprintf(fp, "\n popretry:\n");
+	fprintf(fp, "\tpopdfa(ps);\n");
+	fprintf(fp, "\tif (s_empty(&ps->p_stack))\n");
+	fprintf(fp, "\t\treturn E_SYNTAX;\n");
+	fprintf(fp, "\tgoto dispatch;\n");
+	
+	/* Pop while we are in an accept-only state */
+	fprintf(fp, "\n popaccepted:\n");
+	fprintf(fp, "\tdo {\n");
+	fprintf(fp, "\t\tpopdfa(ps);\n");
+	fprintf(fp, "\t\tif (s_empty(&ps->p_stack))\n");
+	fprintf(fp, "\t\t\treturn E_DONE;\n");
+	fprintf(fp, "\t\ttop = ps->p_stack.s_top;\n");
+	fprintf(fp, "\t\ts = &top->s_dfa->d_state[top->s_state];\n");
+	fprintf(fp, "\t} while (s->s_accept && s->s_narcs == 1);\n");
+	fprintf(fp, "\treturn E_OK;\n");
+	fprintf(fp, "}\n");
+}
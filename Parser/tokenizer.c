@@ -14,12 +14,51 @@
 
 #ifdef THINK_C
 #define TABSIZE 4
-#endif
+extern int isatty PROTO((int)); /* From pythonmain.c */
+#else /* !THINK_C */
+#include <unistd.h>
+#endif /* !THINK_C */
 
 #ifndef TABSIZE
 #define TABSIZE 8
 #endif
 
+/* Character classes, so the inner loops need one table lookup per
+   character instead of a chain of tests */
+
+#define C_SPACE		0x01	/* ' ' and '\t' */
+#define C_NAME		0x02	/* Letter, digit or '_' */
+#define C_DIGIT		0x04	/* Decimal digit */
+#define C_HEX		0x08	/* Hexadecimal digit */
+#define C_OCT		0x10	/* Octal digit */
+#define C_STR		0x20	/* May occur unescaped in a string literal */
+
+static unsigned char char_class[256];
+
+#define CLASS(c)	char_class[(c) & 0xff]
+
+static void
+init_class()
+{
+	register int c;
+	if (char_class['a'] != 0)
+		return;
+	for (c = 0; c < 256; c++) {
+		if (c != '\'' && c != '\\' && c != '\n' && c != '\0')
+			char_class[c] |= C_STR;
+		if (isalnum(c) || c == '_')
+			char_class[c] |= C_NAME;
+		if (isdigit(c))
+			char_class[c] |= C_DIGIT;
+		if (isxdigit(c))
+			char_class[c] |= C_HEX;
+		if ('0' <= c && c < '8')
+			char_class[c] |= C_OCT;
+	}
+	char_class[' '] |= C_SPACE;
+	char_class['\t'] |= C_SPACE;
+}
+
 /* Token names */
 
 char *tok_name[] = {
@@ -68,6 +107,7 @@ tok_new()
 	tok->buf = tok->cur = tok->end = tok->inp = NULL;
 	tok->done = E_OK;
 	tok->fp = NULL;
+	tok->ownbuf = 0;
 	tok->tabsize = TABSIZE;
 	tok->indent = 0;
 	tok->indstack[0] = 0;
@@ -75,6 +115,7 @@ tok_new()
 	tok->pendin = 0;
 	tok->prompt = tok->nextprompt = NULL;
 	tok->lineno = 0;
+	init_class();
 	return tok;
 }
 
@@ -94,16 +135,52 @@ tok_setups(str)
 }
 
 
-/* Set up tokenizer for string */
+/* Read the rest of a file into the buffer, which becomes the whole
+   input just as for a string.  Return 0 if out of memory. */
+
+static int
+tok_readall(tok, fp)
+	struct tok_state *tok;
+	FILE *fp;
+{
+	int size = BUFSIZ * 4;
+	int n = 0;
+	int k;
+	char *buf = NEW(char, size);
+	if (buf == NULL)
+		return 0;
+	while ((k = fread(buf + n, 1, size - 1 - n, fp)) > 0) {
+		n += k;
+		if (n == size - 1) {
+			char *newbuf = buf;
+			size += size;
+			RESIZE(newbuf, char, size);
+			if (newbuf == NULL) {
+				DEL(buf);
+				return 0;
+			}
+			buf = newbuf;
+		}
+	}
+	buf[n] = '\0';
+	tok->buf = tok->cur = buf;
+	tok->end = tok->inp = buf + n;
+	return 1;
+}
+
+
+/* Set up tokenizer for a file that is read line by line, as needed
+   for prompting; also used for non-interactive files so big that
+   they are parsed a statement at a time (see parsestmt()) */
 
 struct tok_state *
-tok_setupf(fp, ps1, ps2)
+tok_setupl(fp)
 	FILE *fp;
-	char *ps1, *ps2;
 {
 	struct tok_state *tok = tok_new();
 	if (tok == NULL)
 		return NULL;
+	tok->ownbuf = 1;
 	if ((tok->buf = NEW(char, BUFSIZ)) == NULL) {
 		DEL(tok);
 		return NULL;
@@ -111,8 +188,35 @@ tok_setupf(fp, ps1, ps2)
 	tok->cur = tok->inp = tok->buf;
 	tok->end = tok->buf + BUFSIZ;
 	tok->fp = fp;
-	tok->prompt = ps1;
-	tok->nextprompt = ps2;
+	return tok;
+}
+
+
+/* Set up tokenizer for file.  Unless we are prompting, the file is
+   read in one go; interactive input is read line by line. */
+
+struct tok_state *
+tok_setupf(fp, ps1, ps2)
+	FILE *fp;
+	char *ps1, *ps2;
+{
+	struct tok_state *tok;
+	if (ps1 != NULL || isatty(fileno(fp))) {
+		tok = tok_setupl(fp);
+		if (tok != NULL) {
+			tok->prompt = ps1;
+			tok->nextprompt = ps2;
+		}
+		return tok;
+	}
+	tok = tok_new();
+	if (tok == NULL)
+		return NULL;
+	tok->ownbuf = 1;
+	if (!tok_readall(tok, fp)) {
+		DEL(tok);
+		return NULL;
+	}
 	return tok;
 }
 
@@ -123,8 +227,7 @@ void
 tok_free(tok)
 	struct tok_state *tok;
 {
-	/* XXX really need a separate flag to say 'my buffer' */
-	if (tok->fp != NULL && tok->buf != NULL)
+	if (tok->ownbuf && tok->buf != NULL)
 		DEL(tok->buf);
 	DEL(tok);
 }
@@ -220,6 +323,30 @@ tok_nextc(tok)
 }
 
 
+/* Skip characters in the given classes and return the first one that
+   isn't, like a loop calling tok_nextc.  Most of the time the run ends
+   inside the buffer and is scanned without calling tok_nextc. */
+
+static int
+tok_skip(tok, mask)
+	register struct tok_state *tok;
+	register int mask;
+{
+	register char *p = tok->cur;
+	register char *end = tok->inp;
+	register int c;
+	while (p < end && (CLASS(*p) & mask))
+		p++;
+	tok->cur = p;
+	if (p < end && tok->done == E_OK)
+		return *tok->cur++;
+	do {
+		c = tok_nextc(tok);
+	} while (c != EOF && (CLASS(c) & mask));
+	return c;
+}
+
+
 /* Back-up one character */
 
 static void
@@ -339,9 +466,7 @@ tok_get(tok, p_start, p_end)
 	
  again:
 	/* Skip spaces */
-	do {
-		c = tok_nextc(tok);
-	} while (c == ' ' || c == '\t');
+	c = tok_skip(tok, C_SPACE);
 	
 	/* Set start of current token */
 	*p_start = tok->cur - 1;
@@ -351,26 +476,36 @@ tok_get(tok, p_start, p_end)
 		/* Hack to allow overriding the tabsize in the file.
 		   This is also recognized by vi, when it occurs near the
 		   beginning or end of the file.  (Will vi never die...?) */
+		/* Check cheaply first: sscanf may scan the whole buffer */
+		char *p = tok->cur;
 		int x;
-		if (sscanf(tok->cur, " vi:set tabsize=%d:", &x) == 1 &&
+		while (*p == ' ' || *p == '\t')
+			p++;
+		if (strncmp(p, "vi:", 3) == 0 &&
+			sscanf(p, "vi:set tabsize=%d:", &x) == 1 &&
 						x >= 1 && x <= 40) {
 			fprintf(stderr, "# vi:set tabsize=%d:\n", x);
 			tok->tabsize = x;
 		}
+		if (tok->fp == NULL) {
+			/* All input is in the buffer */
+			p = memchr(tok->cur, '\n', (int)(tok->inp - tok->cur));
+			tok->cur = p == NULL ? tok->inp : p;
+		}
 		do {
 			c = tok_nextc(tok);
 		} while (c != EOF && c != '\n');
 	}
 	
 	/* Check for EOF and errors now */
-	if (c == EOF)
+	if (c == EOF) {
+		*p_start = *p_end = tok->cur;
 		return tok->done == E_EOF ? ENDMARKER : ERRORTOKEN;
+	}
 	
 	/* Identifier (most frequent token!) */
 	if (isalpha(c) || c == '_') {
-		do {
-			c = tok_nextc(tok);
-		} while (isalnum(c) || c == '_');
+		c = tok_skip(tok, C_NAME);
 		tok_backup(tok, c);
 		*p_end = tok->cur;
 		return NAME;
@@ -392,23 +527,16 @@ tok_get(tok, p_start, p_end)
 				goto fraction;
 			if (c == 'x' || c == 'X') {
 				/* Hex */
-				do {
-					c = tok_nextc(tok);
-				} while (isxdigit(c));
+				c = tok_skip(tok, C_HEX);
 			}
-			else {
+			else if (CLASS(c) & C_OCT) {
 				/* Octal; c is first char of it */
-				/* There's no 'isoctdigit' macro, sigh */
-				while ('0' <= c && c < '8') {
-					c = tok_nextc(tok);
-				}
+				c = tok_skip(tok, C_OCT);
 			}
 		}
 		else {
 			/* Decimal */
-			do {
-				c = tok_nextc(tok);
-			} while (isdigit(c));
+			c = tok_skip(tok, C_DIGIT);
 			/* Accept floating point numbers.
 			   XXX This accepts incomplete things like 12e or 1e+;
 			       worry about that at run-time.
@@ -416,18 +544,15 @@ tok_get(tok, p_start, p_end)
 			if (c == '.') {
 	fraction:
 				/* Fraction */
-				do {
-					c = tok_nextc(tok);
-				} while (isdigit(c));
+				c = tok_skip(tok, C_DIGIT);
 			}
 			if (c == 'e' || c == 'E') {
 				/* Exponent part */
 				c = tok_nextc(tok);
 				if (c == '+' || c == '-')
 					c = tok_nextc(tok);
-				while (isdigit(c)) {
-					c = tok_nextc(tok);
-				}
+				if (CLASS(c) & C_DIGIT)
+					c = tok_skip(tok, C_DIGIT);
 			}
 		}
 		tok_backup(tok, c);
@@ -438,7 +563,7 @@ tok_get(tok, p_start, p_end)
 	/* String */
 	if (c == '\'') {
 		for (;;) {
-			c = tok_nextc(tok);
+			c = tok_skip(tok, C_STR);
 			if (c == '\n' || c == EOF) {
 				tok->done = E_TOKEN;
 				return ERRORTOKEN;
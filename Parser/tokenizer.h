@@ -13,7 +13,8 @@ struct tok_state {
 	char *inp;	/* End of data in buffer */
 	char *end;	/* End of input buffer */
 	int done;	/* 0 normally, 1 at EOF, -1 after error */
-	FILE *fp;	/* Rest of input; NULL if tokenizing a string */
+	FILE *fp;	/* Rest of input; NULL if all input is in buf */
+	int ownbuf;	/* Nonzero if buf must be freed */
 	int tabsize;	/* Tab spacing */
 	int indent;	/* Current indentation index */
 	int indstack[MAXINDENT];	/* Stack of indents */
@@ -25,5 +26,6 @@ struct tok_state {
 
 extern struct tok_state *tok_setups PROTO((char *));
 extern struct tok_state *tok_setupf PROTO((FILE *, char *ps1, char *ps2));
+extern struct tok_state *tok_setupl PROTO((FILE *));
 extern void tok_free PROTO((struct tok_state *));
 extern int tok_get PROTO((struct tok_state *, char **, char **));
@@ -15,6 +15,7 @@
 #include "builtinobject.h"
 #include "methodobject.h"
 #include "moduleobject.h"
+#include "modsupport.h"
 #include "context.h"
 #include "funcobject.h"
 #include "classobject.h"
@@ -36,12 +37,6 @@
 #define GETITEMNAME(v, i) getstringvalue(getlistitem((v), (i)))
 #endif
 
-typedef struct {
-	int b_type;		/* what kind of block this is */
-	int b_handler;		/* where to jump to find handler */
-	int b_level;		/* value stack level to pop to */
-} block;
-
 typedef struct _frame {
 	OB_HEAD
 	struct _frame *f_back;	/* previous frame, or NULL */
@@ -49,11 +44,8 @@ typedef struct _frame {
 	object *f_locals;	/* local symbol table (dictobject) */
 	object *f_globals;	/* global symbol table (dictobject) */
 	object **f_valuestack;	/* malloc'ed array */
-	block *f_blockstack;	/* malloc'ed array */
 	int f_nvalues;		/* size of f_valuestack */
-	int f_nblocks;		/* size of f_blockstack */
 	int f_ivalue;		/* index in f_valuestack */
-	int f_iblock;		/* index in f_blockstack */
 	int f_nexti;		/* index in f_code (next instruction) */
 } frameobject;
 
@@ -68,7 +60,6 @@ frame_dealloc(f)
 	XDECREF(f->f_locals);
 	XDECREF(f->f_globals);
 	XDEL(f->f_valuestack);
-	XDEL(f->f_blockstack);
 	DEL(f);
 }
 typeobject Frametype = {
@@ -89,23 +80,22 @@ typeobject Frametype = {
 };
 
 static frameobject * newframeobject PROTO(
-	(frameobject *, codeobject *, object *, object *, int, int));
+	(frameobject *, codeobject *, object *, object *, int));
 
 static frameobject *
-newframeobject(back, code, locals, globals, nvalues, nblocks)
+newframeobject(back, code, locals, globals, nvalues)
 	frameobject *back;
 	codeobject *code;
 	object *locals;
 	object *globals;
 	int nvalues;
-	int nblocks;
 {
 	frameobject *f;
 	if ((back != NULL && !is_frameobject(back)) ||
 		code == NULL || !is_codeobject(code) ||
 		locals == NULL || !is_dictobject(locals) ||
 		globals == NULL || !is_dictobject(globals) ||
-		nvalues < 0 || nblocks < 0) {
+		nvalues < 0) {
 		err_badcall();
 		return NULL;
 	}
@@ -121,11 +111,9 @@ newframeobject(back, code, locals, globals, nvalues, nblocks)
 		INCREF(globals);
 		f->f_globals = globals;
 		f->f_valuestack = NEW(object *, nvalues+1);
-		f->f_blockstack = NEW(block, nblocks+1);
 		f->f_nvalues = nvalues;
-		f->f_nblocks = nblocks;
-		f->f_ivalue = f->f_iblock = f->f_nexti = 0;
-		if (f->f_valuestack == NULL || f->f_blockstack == NULL) {
+		f->f_ivalue = f->f_nexti = 0;
+		if (f->f_valuestack == NULL) {
 			err_nomem();
 			DECREF(f);
 			f = NULL;
@@ -139,11 +127,9 @@ newframeobject(back, code, locals, globals, nvalues, nblocks)
 #define Top(f)		((f)->f_valuestack[(f)->f_ivalue-1])
 #define Empty(f)	((f)->f_ivalue == 0)
 #define Full(f)		((f)->f_ivalue == (f)->f_nvalues)
-#define Nextbyte(f)	(GETSTRINGVALUE((f)->f_code->co_code)[(f)->f_nexti++])
-#define Peekbyte(f)	(GETSTRINGVALUE((f)->f_code->co_code)[(f)->f_nexti])
-#define Prevbyte(f)	(GETSTRINGVALUE((f)->f_code->co_code)[(f)->f_nexti-1])
+#define Nextinstr(f)	((f)->f_nexti += 2, INSTR((unsigned char *) \
+			GETSTRINGVALUE((f)->f_code->co_code) + (f)->f_nexti - 2))
 #define Jumpto(f, x)	((f)->f_nexti = (x))
-#define Jumpby(f, x)	((f)->f_nexti += (x))
 #define Getconst(f, i)	(GETITEM((f)->f_code->co_consts, (i)))
 #define Getname(f, i)	(GETITEMNAME((f)->f_code->co_names, (i)))
 
@@ -184,15 +170,15 @@ top(f)
 }
 
 static int
-nextbyte(f)
+nextinstr(f)
 	frameobject *f;
 {
 	stringobject *code = (f)->f_code->co_code;
-	if (f->f_nexti >= getstringsize((object *)code)) {
+	if (f->f_nexti + 2 > getstringsize((object *)code)) {
 		printf("ran off end of instructions\n");
 		abort();
 	}
-	return GETSTRINGVALUE(code)[f->f_nexti++];
+	return Nextinstr(f);
 }
 
 /* Tracing versions */
@@ -233,60 +219,20 @@ trace_top(f)
 }
 
 static int
-trace_nextop(f)
+trace_nextinstr(f)
 	frameobject *f;
 {
-	int op;
-	int arg;
+	int word;
 	
 	printf("%d: ", f->f_nexti);
-	op = nextbyte(f);
-	if (op < HAVE_ARGUMENT)
-		printf("op %3d\n", op);
-	else {
-		arg = Peekbyte(f);
-		printf("op %3d arg %3d\n", op, arg);
-	}
-	return op;
-}
-
-/* Block management */
-
-static void
-setup_block(f, type, handler)
-	frameobject *f;
-	int type;
-	int handler;
-{
-	block *b;
-	if (f->f_iblock >= f->f_nblocks) {
-		printf("block stack overflow\n");
-		abort();
-	}
-	b = &f->f_blockstack[f->f_iblock++];
-	b->b_type = type;
-	b->b_level = f->f_ivalue;
-	b->b_handler = handler + f->f_nexti;
-}
-
-static block *
-pop_block(f)
-	frameobject *f;
-{
-	block *b;
-	if (f->f_iblock <= 0) {
-		printf("block stack underflow\n");
-		abort();
-	}
-	b = &f->f_blockstack[--f->f_iblock];
-	while (f->f_ivalue > b->b_level) {
-		object *v = Pop(f);
-		XDECREF(v);
-	}
-	return b;
+	word = nextinstr(f);
+	if (OPCODE(word) < HAVE_ARGUMENT)
+		printf("op %3d\n", OPCODE(word));
+	else
+		printf("op %3d arg %3d\n", OPCODE(word), OPARG(word));
+	return word;
 }
 
-
 /* XXX Mixing "print ...," and direct file I/O on stdin/stdout
    XXX has some bad consequences.  The needspace flag should
    XXX really be part of the file object. */
@@ -318,7 +264,8 @@ add(ctx, v, w)
 	context *ctx;
 	object *v, *w;
 {
-	if (v->ob_type->tp_as_number != NULL)
+	if (v->ob_type->tp_as_number != NULL &&
+			v->ob_type->tp_as_number->nb_add != NULL)
 		v = (*v->ob_type->tp_as_number->nb_add)(v, w);
 	else if (v->ob_type->tp_as_sequence != NULL)
 		v = (*v->ob_type->tp_as_sequence->sq_concat)(v, w);
@@ -334,7 +281,8 @@ sub(ctx, v, w)
 	context *ctx;
 	object *v, *w;
 {
-	if (v->ob_type->tp_as_number != NULL)
+	if (v->ob_type->tp_as_number != NULL &&
+			v->ob_type->tp_as_number->nb_subtract != NULL)
 		return checkerror(ctx,
 			(*v->ob_type->tp_as_number->nb_subtract)(v, w));
 	type_error(ctx, "bad operand type(s) for -");
@@ -354,7 +302,7 @@ mul(ctx, v, w)
 		w = tmp;
 	}
 	tp = v->ob_type;
-	if (tp->tp_as_number != NULL)
+	if (tp->tp_as_number != NULL && tp->tp_as_number->nb_multiply != NULL)
 		return checkerror(ctx, (*tp->tp_as_number->nb_multiply)(v, w));
 	if (tp->tp_as_sequence != NULL) {
 		if (!is_intobject(w)) {
@@ -377,7 +325,8 @@ div(ctx, v, w)
 	context *ctx;
 	object *v, *w;
 {
-	if (v->ob_type->tp_as_number != NULL)
+	if (v->ob_type->tp_as_number != NULL &&
+			v->ob_type->tp_as_number->nb_divide != NULL)
 		return checkerror(ctx,
 			(*v->ob_type->tp_as_number->nb_divide)(v, w));
 	type_error(ctx, "bad operand type(s) for /");
@@ -389,7 +338,8 @@ rem(ctx, v, w)
 	context *ctx;
 	object *v, *w;
 {
-	if (v->ob_type->tp_as_number != NULL)
+	if (v->ob_type->tp_as_number != NULL &&
+			v->ob_type->tp_as_number->nb_remainder != NULL)
 		return checkerror(ctx,
 			(*v->ob_type->tp_as_number->nb_remainder)(v, w));
 	type_error(ctx, "bad operand type(s) for %");
@@ -401,7 +351,8 @@ neg(ctx, v)
 	context *ctx;
 	object *v;
 {
-	if (v->ob_type->tp_as_number != NULL)
+	if (v->ob_type->tp_as_number != NULL &&
+			v->ob_type->tp_as_number->nb_negative != NULL)
 		return checkerror(ctx,
 			(*v->ob_type->tp_as_number->nb_negative)(v));
 	type_error(ctx, "bad operand type(s) for unary -");
@@ -413,7 +364,8 @@ pos(ctx, v)
 	context *ctx;
 	object *v;
 {
-	if (v->ob_type->tp_as_number != NULL)
+	if (v->ob_type->tp_as_number != NULL &&
+			v->ob_type->tp_as_number->nb_positive != NULL)
 		return checkerror(ctx,
 			(*v->ob_type->tp_as_number->nb_positive)(v));
 	type_error(ctx, "bad operand type(s) for unary +");
@@ -431,6 +383,20 @@ not(ctx, v)
 	return checkerror(ctx, newintobject((long) !outcome));
 }
 
+/* Call a built-in method that takes an argument array */
+
+static object *
+call_array(ctx, func, self, argv, argc)
+	context *ctx;
+	object *func;
+	object *self;
+	object **argv;
+	int argc;
+{
+	arraymethod meth = (arraymethod) getmethod(func);
+	return checkerror(ctx, (*meth)(self, argv, argc));
+}
+
 static object *
 call_builtin(ctx, func, args)
 	context *ctx;
@@ -444,6 +410,15 @@ call_builtin(ctx, func, args)
 	if (is_methodobject(func)) {
 		method meth = getmethod(func);
 		object *self = getself(func);
+		if (getmethodflags(func) & METH_ARRAY) {
+			if (args == NULL)
+				return call_array(ctx, func, self,
+							(object **)NULL, 0);
+			if (is_tupleobject(args))
+				return call_array(ctx, func, self,
+					gettupleitems(args), gettuplesize(args));
+			return call_array(ctx, func, self, &args, 1);
+		}
 		return checkerror(ctx, (*meth)(self, args));
 	}
 	if (is_classobject(func)) {
@@ -457,76 +432,133 @@ call_builtin(ctx, func, args)
 	return NULL;
 }
 
-static object *eval_compiled PROTO((context *, codeobject *, object *, int));
+static object *eval_compiled
+	PROTO((context *, codeobject *, object *, object *, int));
 
 /* XXX Eventually, this should not call eval_compiled recursively
    but create a new frame */
 
+/* Call a function; if self is not NULL, as a method of self */
+
 static object *
-call_function(ctx, func, args)
+call_code(ctx, func, self, args)
 	context *ctx;
 	object *func;
+	object *self;
 	object *args;
 {
-	object *newargs = NULL;
 	object *savelocals, *newlocals, *saveglobals;
 	object *c, *v;
 	
-	if (is_classmethodobject(func)) {
-		object *self = classmethodgetself(func);
-		func = classmethodgetfunc(func);
-		if (args == NULL) {
-			args = self;
-		}
-		else {
-			newargs = checkerror(ctx, newtupleobject(2));
-			if (newargs == NULL)
-				return NULL;
-			INCREF(self);
-			INCREF(args);
-			settupleitem(newargs, 0, self);
-			settupleitem(newargs, 1, args);
-			args = newargs;
-		}
-	}
-	else {
-		if (!is_funcobject(func)) {
-			type_error(ctx, "call of non-function");
-			return NULL;
-		}
-	}
-	
 	c = checkerror(ctx, getfunccode(func));
-	if (c == NULL) {
-		XDECREF(newargs);
+	if (c == NULL)
 		return NULL;
-	}
 	if (!is_codeobject(c)) {
 		printf("Bad code\n");
 		abort();
 	}
 	newlocals = checkerror(ctx, newdictobject());
-	if (newlocals == NULL) {
-		XDECREF(newargs);
+	if (newlocals == NULL)
 		return NULL;
-	}
 	
 	savelocals = ctx->ctx_locals;
 	ctx->ctx_locals = newlocals;
 	saveglobals = ctx->ctx_globals;
 	ctx->ctx_globals = getfuncglobals(func);
 	
-	v = eval_compiled(ctx, (codeobject *)c, args, 1);
+	v = eval_compiled(ctx, (codeobject *)c, self, args, 1);
 	
 	DECREF(ctx->ctx_locals);
 	ctx->ctx_locals = savelocals;
 	ctx->ctx_globals = saveglobals;
 	
-	XDECREF(newargs);
-	
 	return v;
 }
 
+static object *
+call_function(ctx, func, args)
+	context *ctx;
+	object *func;
+	object *args;
+{
+	if (is_classmethodobject(func))
+		return call_code(ctx, classmethodgetfunc(func),
+					classmethodgetself(func), args);
+	if (!is_funcobject(func)) {
+		type_error(ctx, "call of non-function");
+		return NULL;
+	}
+	return call_code(ctx, func, (object *)NULL, args);
+}
+
+/* Call func with the argc arguments in argv, as left on the value
+   stack by CALL_FUNCTION or CALL_METHOD; if self is not NULL, as a
+   method of self (func is then a function, or a built-in method
+   without self from getmethodfunc).  A built-in method that takes an
+   argument array gets argv itself, or the items of a lone tuple
+   argument (as in call_builtin); anything else gets the arguments as
+   before: NULL, the one argument, or a tuple. */
+
+static object *
+call_args(ctx, func, self, argv, argc)
+	context *ctx;
+	object *func;
+	object *self;
+	object **argv;
+	int argc;
+{
+	object *args, *x;
+	int i;
+	if (is_methodobject(func) && (getmethodflags(func) & METH_ARRAY)) {
+		if (self == NULL)
+			self = getself(func);
+		if (argc == 1 && is_tupleobject(argv[0]))
+			return call_array(ctx, func, self,
+				gettupleitems(argv[0]), gettuplesize(argv[0]));
+		return call_array(ctx, func, self, argv, argc);
+	}
+	if (argc == 0)
+		args = NULL;
+	else if (argc == 1) {
+		args = argv[0];
+		INCREF(args);
+	}
+	else {
+		args = checkerror(ctx, newtupleobject(argc));
+		if (args == NULL)
+			return NULL;
+		for (i = 0; i < argc; i++) {
+			INCREF(argv[i]);
+			settupleitem(args, i, argv[i]);
+		}
+	}
+	if (self != NULL && is_methodobject(func))
+		x = checkerror(ctx, (*getmethod(func))(self, args));
+	else if (self != NULL)
+		x = call_code(ctx, func, self, args);
+	else if (is_classmethodobject(func) || is_funcobject(func))
+		x = call_function(ctx, func, args);
+	else
+		x = call_builtin(ctx, func, args);
+	XDECREF(args);
+	return x;
+}
+
+static object *
+load_attr(ctx, v, name)
+	context *ctx;
+	object *v;
+	char *name;
+{
+	if (LOAD_LAZY(ctx, v))
+		return NULL;
+	if (v->ob_type->tp_getattr == NULL) {
+		type_error(ctx, "attribute-less object");
+		return NULL;
+	}
+	return checkerror(ctx, (*v->ob_type->tp_getattr)(v, name));
+}
+
 static object *
 apply_subscript(ctx, v, w)
 	context *ctx;
@@ -721,9 +753,10 @@ cmp_outcome(ctx, op, v, w)
 }
 
 static object *
-eval_compiled(ctx, co, arg, needvalue)
+eval_compiled(ctx, co, self, arg, needvalue)
 	context *ctx;
 	codeobject *co;
+	object *self; /* NULL, or the object of a method call */
 	object *arg;
 	int needvalue;
 {
@@ -734,6 +767,11 @@ eval_compiled(ctx, co, arg, needvalue)
 	register object *x;
 	char *name;
 	int n, i;
+	int word;
+	register int opcode, oparg;
+	int lasti;		/* Offset of the current instruction */
+	unsigned char *xt;	/* Exception table */
+	int nxt;		/* Number of entries */
 	enum cmp_op op;
 	FILE *fp;
 #ifndef NDEBUG
@@ -745,38 +783,69 @@ eval_compiled(ctx, co, arg, needvalue)
 			co,			/*code*/
 			ctx->ctx_locals,	/*locals*/
 			ctx->ctx_globals,	/*globals*/
-			50,			/*nvalues*/
-			20);			/*nblocks*/
+			50);			/*nvalues*/
 	if (f == NULL) {
 		puterrno(ctx);
 		return NULL;
 	}
+	xt = (unsigned char *) GETSTRINGVALUE(co->co_xtable);
+	nxt = getstringsize((object *)co->co_xtable) / XT_ENTRY;
 
 #define EMPTY()		Empty(f)
 #define FULL()		Full(f)
 #define GETCONST(i)	Getconst(f, i)
 #define GETNAME(i)	Getname(f, i)
 #define JUMPTO(x)	Jumpto(f, x)
-#define JUMPBY(x)	Jumpby(f, x)
 
 #ifdef NDEBUG
 
 #define PUSH(v) 	Push(f, v)
 #define TOP()		Top(f)
 #define POP()		Pop(f)
-#define NEXTOP()	Nextbyte(f)
-#define NEXTI()		Nextbyte(f)
+#define NEXTINSTR()	Nextinstr(f)
 
 #else
 
 #define PUSH(v) if(trace) trace_push(f, v); else push(f, v)
 #define TOP() (trace ? trace_top(f) : top(f))
 #define POP() (trace ? trace_pop(f) : pop(f))
-#define NEXTOP() (trace ? trace_nextop(f) : nextbyte(f))
-#define NEXTI()  (nextbyte(f))
+#define NEXTINSTR() (trace ? trace_nextinstr(f) : nextinstr(f))
 
 #endif
 
+	/* A method gets the tuple (self, arg), or just self if there is
+	   no argument.  When its code starts by unpacking the tuple, the
+	   items are pushed and the unpacking is skipped instead. */
+	if (self != NULL) {
+		unsigned char *code =
+			(unsigned char *) GETSTRINGVALUE(co->co_code);
+		if (arg == NULL) {
+			arg = self;
+			self = NULL;
+		}
+		else if (getstringsize((object *)co->co_code) >= 4 &&
+				OPCODE(INSTR(code)) == REQUIRE_ARGS &&
+				OPCODE(INSTR(code+2)) == UNPACK_TUPLE &&
+				OPARG(INSTR(code+2)) == 2) {
+			INCREF(arg);
+			PUSH(arg);
+			INCREF(self);
+			PUSH(self);
+			JUMPTO(4);
+			arg = self = NULL;
+		}
+		else {
+			v = checkerror(ctx, newtupleobject(2));
+			if (v != NULL) {
+				INCREF(self);
+				settupleitem(v, 0, self);
+				INCREF(arg);
+				settupleitem(v, 1, arg);
+				PUSH(v);
+			}
+			arg = self = NULL;
+		}
+	}
 	if (arg != NULL) {
 		INCREF(arg);
 		PUSH(arg);
@@ -785,7 +854,18 @@ eval_compiled(ctx, co, arg, needvalue)
 	while (f->f_nexti < getstringsize((object *)f->f_code->co_code) &&
 				!ctx->ctx_exception) {
 		
-		switch (NEXTOP()) {
+		lasti = f->f_nexti;
+		word = NEXTINSTR();
+		opcode = OPCODE(word);
+		oparg = OPARG(word);
+	 dispatch:
+		switch (opcode) {
+		
+		case EXTENDED_ARG:
+			word = NEXTINSTR();
+			opcode = OPCODE(word);
+			oparg = oparg << 8 | OPARG(word);
+			goto dispatch;
 		
 		case DUP_TOP:
 			v = TOP();
@@ -844,7 +924,7 @@ eval_compiled(ctx, co, arg, needvalue)
 		
 		case UNARY_CALL:
 			v = POP();
-			if (is_classmemberobject(v) || is_funcobject(v))
+			if (is_classmethodobject(v) || is_funcobject(v))
 				u = call_function(ctx, v, (object *)NULL);
 			else
 				u = call_builtin(ctx, v, (object *)NULL);
@@ -909,7 +989,7 @@ eval_compiled(ctx, co, arg, needvalue)
 		case BINARY_CALL:
 			w = POP();
 			v = POP();
-			if (is_classmemberobject(v) || is_funcobject(v))
+			if (is_classmethodobject(v) || is_funcobject(v))
 				u = call_function(ctx, v, w);
 			else
 				u = call_builtin(ctx, v, w);
@@ -1143,10 +1223,6 @@ eval_compiled(ctx, co, arg, needvalue)
 			PUSH(x);
 			break;
 		
-		case POP_BLOCK:
-			(void) pop_block(f);
-			break;
-		
 		case END_FINALLY:
 			v = POP();
 			w = POP();
@@ -1170,7 +1246,7 @@ eval_compiled(ctx, co, arg, needvalue)
 			break;
 		
 		case STORE_NAME:
-			i = NEXTI();
+			i = oparg;
 			name = GETNAME(i);
 			v = POP();
 			if (dictinsert(ctx->ctx_locals, name, v) != 0)
@@ -1179,14 +1255,14 @@ eval_compiled(ctx, co, arg, needvalue)
 			break;
 		
 		case DELETE_NAME:
-			i = NEXTI();
+			i = oparg;
 			name = GETNAME(i);
 			if (dictremove(ctx->ctx_locals, name) != 0)
 				name_error(ctx, name);
 			break;
 		
 		case UNPACK_TUPLE:
-			n = NEXTI();
+			n = oparg;
 			v = POP();
 			if (!is_tupleobject(v)) {
 				type_error(ctx, "unpack non-tuple");
@@ -1205,7 +1281,7 @@ eval_compiled(ctx, co, arg, needvalue)
 			break;
 		
 		case UNPACK_LIST:
-			n = NEXTI();
+			n = oparg;
 			v = POP();
 			if (!is_listobject(v)) {
 				type_error(ctx, "unpack non-list");
@@ -1224,12 +1300,14 @@ eval_compiled(ctx, co, arg, needvalue)
 			break;
 		
 		case STORE_ATTR:
-			i = NEXTI();
+			i = oparg;
 			name = GETNAME(i);
 			v = POP();
 			u = POP();
 			/* v.name = u */
-			if (v->ob_type->tp_setattr == NULL) {
+			if (LOAD_LAZY(ctx, v))
+				;
+			else if (v->ob_type->tp_setattr == NULL) {
 				type_error(ctx, "object without writable attributes");
 			}
 			else {
@@ -1241,11 +1319,13 @@ eval_compiled(ctx, co, arg, needvalue)
 			break;
 		
 		case DELETE_ATTR:
-			i = NEXTI();
+			i = oparg;
 			name = GETNAME(i);
 			v = POP();
 			/* del v.name */
-			if (v->ob_type->tp_setattr == NULL) {
+			if (LOAD_LAZY(ctx, v))
+				;
+			else if (v->ob_type->tp_setattr == NULL) {
 				type_error(ctx,
 					"object without writable attributes");
 			}
@@ -1258,14 +1338,14 @@ eval_compiled(ctx, co, arg, needvalue)
 			break;
 		
 		case LOAD_CONST:
-			i = NEXTI();
+			i = oparg;
 			v = GETCONST(i);
 			INCREF(v);
 			PUSH(v);
 			break;
 		
 		case LOAD_NAME:
-			i = NEXTI();
+			i = oparg;
 			name = GETNAME(i);
 			v = dictlookup(ctx->ctx_locals, name);
 			if (v == NULL) {
@@ -1282,7 +1362,7 @@ eval_compiled(ctx, co, arg, needvalue)
 			break;
 		
 		case BUILD_TUPLE:
-			n = NEXTI();
+			n = oparg;
 			v = checkerror(ctx, newtupleobject(n));
 			if (v != NULL) {
 				for (i = n; --i >= 0;) {
@@ -1294,7 +1374,7 @@ eval_compiled(ctx, co, arg, needvalue)
 			break;
 		
 		case BUILD_LIST:
-			n = NEXTI();
+			n = oparg;
 			v = checkerror(ctx, newlistobject(n));
 			if (v != NULL) {
 				for (i = n; --i >= 0;) {
@@ -1306,29 +1386,66 @@ eval_compiled(ctx, co, arg, needvalue)
 			break;
 		
 		case BUILD_MAP:
-			(void) NEXTI();
 			v = checkerror(ctx, newdictobject());
 			PUSH(v);
 			break;
 		
 		case LOAD_ATTR:
-			i = NEXTI();
+			i = oparg;
 			name = GETNAME(i);
 			v = POP();
-			if (v->ob_type->tp_getattr == NULL) {
-				type_error(ctx, "attribute-less object");
-				u = NULL;
+			u = load_attr(ctx, v, name);
+			DECREF(v);
+			PUSH(u);
+			break;
+		
+		case LOAD_METHOD:
+			i = oparg;
+			name = GETNAME(i);
+			v = POP();
+			u = classmembergetfunc(v, name);
+			if (u == NULL)
+				u = getmethodfunc(v, name);
+			if (u != NULL) {
+				PUSH(u);
+				PUSH(v);
 			}
 			else {
-				u = checkerror(ctx,
-					(*v->ob_type->tp_getattr)(v, name));
+				u = load_attr(ctx, v, name);
+				DECREF(v);
+				PUSH(u);
+				PUSH((object *)NULL);
+			}
+			break;
+		
+		case CALL_METHOD:
+		case CALL_FUNCTION:
+			/* The arguments are the top oparg values; below
+			   them are self (or NULL) for CALL_METHOD, and the
+			   function or other callable */
+			n = oparg;
+			i = f->f_ivalue - n;
+			if (opcode == CALL_METHOD)
+				u = f->f_valuestack[i-1];
+			else
+				u = NULL;
+			v = f->f_valuestack[opcode == CALL_METHOD ? i-2 : i-1];
+			x = call_args(ctx, v, u, &f->f_valuestack[i], n);
+			while (--n >= 0) {
+				w = POP();
+				DECREF(w);
 			}
+			if (opcode == CALL_METHOD) {
+				u = POP();
+				XDECREF(u);
+			}
+			v = POP();
 			DECREF(v);
-			PUSH(u);
+			PUSH(x);
 			break;
 		
 		case COMPARE_OP:
-			op = NEXTI();
+			op = oparg;
 			w = POP();
 			v = POP();
 			u = cmp_outcome(ctx, op, v, w);
@@ -1338,7 +1455,7 @@ eval_compiled(ctx, co, arg, needvalue)
 			break;
 		
 		case IMPORT_NAME:
-			i = NEXTI();
+			i = oparg;
 			name = GETNAME(i);
 			u = import_module(ctx, name);
 			if (u != NULL) {
@@ -1348,9 +1465,11 @@ eval_compiled(ctx, co, arg, needvalue)
 			break;
 		
 		case IMPORT_FROM:
-			i = NEXTI();
+			i = oparg;
 			name = GETNAME(i);
 			v = TOP();
+			if (LOAD_LAZY(ctx, v))
+				break;
 			w = getmoduledict(v);
 			x = dictlookup(w, name);
 			if (x == NULL)
@@ -1359,33 +1478,22 @@ eval_compiled(ctx, co, arg, needvalue)
 				puterrno(ctx);
 			break;
 		
-		/* WARNING!
-		   Don't assign an expression containing NEXTI() directly
-		   to nexti.  This expands to "nexti = ... + *nexti++"
-		   which has undefined evaluation order.  On some machines
-		   (e.g., mips!) the nexti++ is done after the assignment
-		   to nexti. */
-		
 		case JUMP_FORWARD:
-			n = NEXTI();
-			JUMPBY(n);
+			JUMPTO(oparg);
 			break;
 		
 		case JUMP_IF_FALSE:
-			n = NEXTI();
 			if (!testbool(ctx, TOP()))
-				JUMPBY(n);
+				JUMPTO(oparg);
 			break;
 		
 		case JUMP_IF_TRUE:
-			n = NEXTI();
 			if (testbool(ctx, TOP()))
-				JUMPBY(n);
+				JUMPTO(oparg);
 			break;
 		
 		case JUMP_ABSOLUTE:
-			n = NEXTI();
-			JUMPTO(n);
+			JUMPTO(oparg);
 			/* XXX Should check for interrupts more often? */
 			if (intrcheck())
 				intr_error(ctx);
@@ -1396,8 +1504,7 @@ eval_compiled(ctx, co, arg, needvalue)
 			   On entry: stack contains s, i.
 			   On exit: stack contains s, i+1, s[i];
 			   but if loop exhausted:
-			   	s, i are popped, and we jump n bytes */
-			n = NEXTI();
+			   	s, i are popped, and we jump to the target */
 			w = POP(); /* Loop index */
 			v = POP(); /* Sequence object */
 			x = loop_subscript(ctx, v, w);
@@ -1412,59 +1519,53 @@ eval_compiled(ctx, co, arg, needvalue)
 			else {
 				DECREF(v);
 				DECREF(w);
-				JUMPBY(n);
+				JUMPTO(oparg);
 			}
 			break;
 		
-		case SETUP_LOOP:
-			n = NEXTI();
-			setup_block(f, SETUP_LOOP, n);
-			break;
-		
-		case SETUP_EXCEPT:
-			n = NEXTI();
-			setup_block(f, SETUP_EXCEPT, n);
-			break;
-		
-		case SETUP_FINALLY:
-			n = NEXTI();
-			setup_block(f, SETUP_FINALLY, n);
-			break;
-		
 		default:
-			printf("opcode %d\n", Prevbyte(f));
+			printf("opcode %d\n", opcode);
 			sys_error(ctx, "eval_compiled: unknown opcode");
 			break;
 		
 		}
 		
-		/* Unwind block stack if an exception occurred */
-		
-		while (ctx->ctx_exception && f->f_iblock > 0) {
-			block *b = pop_block(f);
-			if (b->b_type == SETUP_LOOP &&
-					ctx->ctx_exception == BREAK_PSEUDO) {
-				clear_exception(ctx);
-				JUMPTO(b->b_handler);
-				break;
+		/* If an exception occurred, find the innermost block
+		   around the instruction that handles it */
+		
+		if (ctx->ctx_exception) {
+			for (i = nxt; --i >= 0; ) {
+				if (lasti < XT_GET(xt, i, XT_START) ||
+					lasti >= XT_GET(xt, i, XT_END))
+					continue;
+				n = XT_GET(xt, i, XT_TYPE);
+				if (n == XT_LOOP &&
+					ctx->ctx_exception == BREAK_PSEUDO ||
+					n == XT_FINALLY ||
+					n == XT_EXCEPT &&
+					ctx->ctx_exception == CATCHABLE_EXCEPTION)
+					break;
 			}
-			else if (b->b_type == SETUP_FINALLY ||
-				b->b_type == SETUP_EXCEPT &&
-				ctx->ctx_exception == CATCHABLE_EXCEPTION) {
-				v = ctx->ctx_errval;
-				if (v == NULL)
-					v = None;
-				INCREF(v);
-				PUSH(v);
-				v = ctx->ctx_error;
-				if (v == NULL)
-					v = newintobject(ctx->ctx_exception);
-				else
+			if (i >= 0) {
+				while (f->f_ivalue > XT_GET(xt, i, XT_LEVEL)) {
+					v = POP();
+					XDECREF(v);
+				}
+				if (n != XT_LOOP) {
+					v = ctx->ctx_errval;
+					if (v == NULL)
+						v = None;
 					INCREF(v);
-				PUSH(v);
+					PUSH(v);
+					v = ctx->ctx_error;
+					if (v == NULL)
+						v = newintobject(ctx->ctx_exception);
+					else
+						INCREF(v);
+					PUSH(v);
+				}
 				clear_exception(ctx);
-				JUMPTO(b->b_handler);
-				break;
+				JUMPTO(XT_GET(xt, i, XT_HANDLER));
 			}
 		}
 	}
@@ -1508,10 +1609,8 @@ eval_compiled(ctx, co, arg, needvalue)
 #undef GETCONST
 #undef GETNAME
 #undef JUMPTO
-#undef JUMPBY
 
-#undef NEXTOP
-#undef NEXTI
+#undef NEXTINSTR
 #undef POP
 #undef TOP
 #undef PUSH
@@ -1538,7 +1637,7 @@ eval_or_exec(ctx, n, arg, needvalue)
 		puterrno(ctx);
 		return NULL;
 	}
-	v = eval_compiled(ctx, co, arg, needvalue);
+	v = eval_compiled(ctx, co, (object *)NULL, arg, needvalue);
 	DECREF(co);
 	return v;
 }
@@ -1558,3 +1657,12 @@ exec_node(ctx, n)
 {
 	(void) eval_or_exec(ctx, n, (object *)NULL, 0/*needvalue*/);
 }
+
+void
+exec_code(ctx, co)
+	context *ctx;
+	codeobject *co;
+{
+	(void) eval_compiled(ctx, co, (object *)NULL, (object *)NULL,
+							0/*needvalue*/);
+}
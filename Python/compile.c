@@ -1,6 +1,13 @@
 #define DEBUG
 /* Compile an expression node to intermediate code */
 
+/* The parse trees are compact (see parser.c): a node that would have a
+   single non-terminal child is replaced by that child.  So wherever the
+   grammar has e.g. a test, the tree may hold any node from test down
+   to atom, and the expression functions below dispatch through
+   com_node rather than calling each other directly.  Trees that are
+   not compact compile to the same code. */
+
 #include <stdio.h>
 #include <ctype.h>
 #include "string.h"
@@ -9,6 +16,7 @@
 #include "object.h"
 #include "objimpl.h"
 #include "intobject.h"
+#include "longobject.h"
 #include "floatobject.h"
 #include "stringobject.h"
 #include "listobject.h"
@@ -26,6 +34,7 @@ code_dealloc(c)
 	XDECREF(c->co_code);
 	XDECREF(c->co_consts);
 	XDECREF(c->co_names);
+	XDECREF(c->co_xtable);
 	DEL(c);
 }
 
@@ -46,20 +55,48 @@ typeobject Codetype = {
 	0,		/*tp_as_mapping*/
 };
 
-static codeobject *newcodeobject PROTO((object *, object *, object *));
+/* Check the entries of an exception table for code of len bytes */
 
-static codeobject *
-newcodeobject(code, consts, names)
+static int
+checkxtable(len, xtable)
+	long len;
+	object *xtable;
+{
+	unsigned char *xt = (unsigned char *) getstringvalue(xtable);
+	int n = getstringsize(xtable);
+	long type, start, end, handler;
+	int i;
+	if (n % XT_ENTRY != 0)
+		return 0;
+	for (i = n / XT_ENTRY; --i >= 0; ) {
+		type = XT_GET(xt, i, XT_TYPE);
+		start = XT_GET(xt, i, XT_START);
+		end = XT_GET(xt, i, XT_END);
+		handler = XT_GET(xt, i, XT_HANDLER);
+		if (type != XT_LOOP && type != XT_EXCEPT &&
+						type != XT_FINALLY ||
+				start < 0 || start > end || end > len ||
+				handler < 0 || handler > len ||
+				handler % 2 != 0)
+			return 0;
+	}
+	return 1;
+}
+
+codeobject *
+newcodeobject(code, consts, names, xtable)
 	object *code;
 	object *consts;
 	object *names;
+	object *xtable;
 {
 	codeobject *co;
 	int i;
 	/* Check argument types */
 	if (code == NULL || !is_stringobject(code) ||
 		consts == NULL || !is_listobject(consts) ||
-		names == NULL || !is_listobject(names)) {
+		names == NULL || !is_listobject(names) ||
+		xtable == NULL || !is_stringobject(xtable)) {
 		err_badcall();
 		return NULL;
 	}
@@ -71,6 +108,12 @@ newcodeobject(code, consts, names)
 			return NULL;
 		}
 	}
+	/* The interpreter jumps to handlers without checking them, so
+	   make sure the exception table (e.g. from a .pyc) is sane */
+	if (!checkxtable(getstringsize(code), xtable)) {
+		err_setstr(RuntimeError, "bad exception table in code");
+		return NULL;
+	}
 	co = NEWOBJ(codeobject, &Codetype);
 	if (co != NULL) {
 		INCREF(code);
@@ -79,18 +122,30 @@ newcodeobject(code, consts, names)
 		co->co_consts = consts;
 		INCREF(names);
 		co->co_names = names;
+		INCREF(xtable);
+		co->co_xtable = (stringobject *)xtable;
 	}
 	return co;
 }
 
 
-/* Data structure used internally */
+/* Data structures used internally */
+
+struct xentry {
+	int x_field[XT_NFIELDS]; /* Exception table entry (see compile.h) */
+};
+
 struct compiling {
 	object *c_code;		/* string */
 	object *c_consts;	/* list of objects */
 	object *c_names;	/* list of strings (names) */
 	int c_nexti;		/* index into c_code */
 	int c_errors;		/* counts errors occurred */
+	int c_fwdext;		/* EXTENDED_ARG prefixes in forward jumps */
+	int c_retry;		/* set if a forward jump didn't fit */
+	struct xentry *c_xtable; /* exception table entries */
+	int c_nxentries;	/* number of entries */
+	int c_level;		/* value stack level of statements */
 };
 
 /* Prototypes */
@@ -99,7 +154,7 @@ static void com_free PROTO((struct compiling *));
 static void com_done PROTO((struct compiling *));
 static void com_node PROTO((struct compiling *, struct _node *));
 static void com_addbyte PROTO((struct compiling *, int));
-static void com_addint PROTO((struct compiling *, int));
+static void com_addop PROTO((struct compiling *, int));
 static void com_addoparg PROTO((struct compiling *, int, int));
 static void com_addfwref PROTO((struct compiling *, int, int *));
 static void com_backpatch PROTO((struct compiling *, int));
@@ -107,6 +162,8 @@ static int com_add PROTO((struct compiling *, object *, object *));
 static int com_addconst PROTO((struct compiling *, object *));
 static int com_addname PROTO((struct compiling *, object *));
 static void com_addopname PROTO((struct compiling *, int, node *));
+static int com_setup PROTO((struct compiling *, int));
+static void com_endblock PROTO((struct compiling *, int, int));
 
 static int
 com_init(c)
@@ -120,6 +177,11 @@ com_init(c)
 		goto fail_1;
 	c->c_nexti = 0;
 	c->c_errors = 0;
+	c->c_fwdext = 0;
+	c->c_retry = 0;
+	c->c_xtable = NULL;
+	c->c_nxentries = 0;
+	c->c_level = 0;
 	return 1;
 	
   fail_1:
@@ -137,6 +199,7 @@ com_free(c)
 	XDECREF(c->c_code);
 	XDECREF(c->c_consts);
 	XDECREF(c->c_names);
+	XDEL(c->c_xtable);
 }
 
 static void
@@ -169,12 +232,21 @@ com_addbyte(c, byte)
 	getstringvalue(c->c_code)[c->c_nexti++] = byte;
 }
 
+/* Code is a sequence of two-byte instructions: an opcode and an
+   argument byte (see opcode.h).  An argument that doesn't fit in a
+   byte is preceded by EXTENDED_ARG instructions holding its higher
+   bytes.  Jump targets are absolute offsets.  A forward jump is
+   compiled before its target is known, with room for c_fwdext
+   prefixes; if a target doesn't fit, c_retry is set and compile()
+   starts over with more room. */
+
 static void
-com_addint(c, x)
+com_addop(c, op)
 	struct compiling *c;
-	int x;
+	int op;
 {
-	com_addbyte(c, x);
+	com_addbyte(c, op);
+	com_addbyte(c, 0);
 }
 
 static void
@@ -183,8 +255,48 @@ com_addoparg(c, op, arg)
 	int op;
 	int arg;
 {
+	int shift;
+	for (shift = 24; shift > 0; shift -= 8) {
+		if ((unsigned long)arg >> shift != 0) {
+			com_addbyte(c, EXTENDED_ARG);
+			com_addbyte(c, (int)((unsigned long)arg >> shift) & 0xff);
+		}
+	}
 	com_addbyte(c, op);
-	com_addint(c, arg);
+	com_addbyte(c, arg & 0xff);
+}
+
+/* Get or set the argument of the forward jump ending at offset end */
+
+static int
+com_getarg(c, end)
+	struct compiling *c;
+	int end;
+{
+	unsigned char *code = (unsigned char *) getstringvalue(c->c_code);
+	int i, arg = 0;
+	for (i = c->c_fwdext; i >= 0; i--)
+		arg = arg << 8 | code[end - 1 - 2*i];
+	return arg;
+}
+
+static void
+com_setarg(c, end, arg)
+	struct compiling *c;
+	int end;
+	int arg;
+{
+	unsigned char *code = (unsigned char *) getstringvalue(c->c_code);
+	int i;
+	if (c->c_fwdext < 3 && arg >> 8*(c->c_fwdext + 1) != 0) {
+		/* Doesn't fit; the code will be thrown away */
+		c->c_retry = 1;
+		arg = 0;
+	}
+	for (i = 0; i <= c->c_fwdext; i++) {
+		code[end - 1 - 2*i] = arg & 0xff;
+		arg >>= 8;
+	}
 }
 
 static void
@@ -193,14 +305,17 @@ com_addfwref(c, op, p_anchor)
 	int op;
 	int *p_anchor;
 {
-	/* Compile a forward reference for backpatching */
-	int here;
-	int anchor;
-	com_addbyte(c, op);
-	here = c->c_nexti;
-	anchor = *p_anchor;
-	*p_anchor = here;
-	com_addint(c, anchor == 0 ? 0 : here - anchor);
+	/* Compile a forward reference for backpatching; the references
+	   to the same target are chained through their arguments */
+	int anchor = *p_anchor;
+	int i;
+	for (i = 0; i < c->c_fwdext; i++)
+		com_addop(c, EXTENDED_ARG);
+	com_addop(c, op);
+	if (c->c_code == NULL)
+		return;
+	*p_anchor = c->c_nexti;
+	com_setarg(c, c->c_nexti, anchor);
 }
 
 static void
@@ -208,34 +323,85 @@ com_backpatch(c, anchor)
 	struct compiling *c;
 	int anchor; /* Must be nonzero */
 {
-	unsigned char *code = (unsigned char *) getstringvalue(c->c_code);
 	int target = c->c_nexti;
-	int lastanchor = 0;
-	int dist;
 	int prev;
-	for (;;) {
-		/* Make the JUMP instruction at anchor point to target */
-		prev = code[anchor];
-		dist = target - (anchor+1);
-		if (dist > 255 && lastanchor &&
-				code[lastanchor-1] == code[anchor-1]) {
-			/* Attempt to jump to a similar jump closer by */
-/* XXX Show that it works */
-fprintf(stderr, "com_backpatch: huge jump rescued (?)\n");
-			target = lastanchor-1;
-			dist = target - (anchor+1);
-			lastanchor = 0;
-		}
-		if (dist > 255) {
-			err_setstr(SystemError, "relative jump > 255 bytes");
+	if (c->c_code == NULL)
+		return;
+	while (anchor != 0) {
+		/* Make the jump instruction ending at anchor go to target */
+		prev = com_getarg(c, anchor);
+		com_setarg(c, anchor, target);
+		anchor = prev;
+	}
+}
+
+/* Loops and try statements are entered in the exception table (see
+   compile.h) rather than compiled to instructions.  com_setup() opens
+   a block at the current offset and returns its entry number;
+   com_endblock() sets the end or the handler of the block to the
+   current offset. */
+
+static int
+com_setup(c, type)
+	struct compiling *c;
+	int type;
+{
+	struct xentry *x;
+	if (c->c_nxentries % 10 == 0) {
+		x = c->c_xtable; /* Keep the old table if RESIZE fails */
+		RESIZE(x, struct xentry, c->c_nxentries + 10);
+		if (x == NULL) {
+			err_nomem();
 			c->c_errors++;
+			return -1;
 		}
-		code[anchor] = dist;
-		if (!prev)
-			break;
-		lastanchor = anchor;
-		anchor -= prev;
+		c->c_xtable = x;
 	}
+	x = &c->c_xtable[c->c_nxentries];
+	x->x_field[XT_TYPE] = type;
+	x->x_field[XT_START] = c->c_nexti;
+	x->x_field[XT_END] = c->c_nexti;
+	x->x_field[XT_HANDLER] = c->c_nexti;
+	x->x_field[XT_LEVEL] = c->c_level;
+	return c->c_nxentries++;
+}
+
+static void
+com_endblock(c, i, field)
+	struct compiling *c;
+	int i;
+	int field; /* XT_END or XT_HANDLER */
+{
+	if (i >= 0 && i < c->c_nxentries)
+		c->c_xtable[i].x_field[field] = c->c_nexti;
+}
+
+/* Make the exception table string */
+
+static object *
+com_xtable(c)
+	struct compiling *c;
+{
+	object *v;
+	unsigned char *p;
+	int i, k, j;
+	long x;
+	v = newsizedstringobject((char *)NULL, c->c_nxentries * XT_ENTRY);
+	if (v == NULL) {
+		c->c_errors++;
+		return NULL;
+	}
+	p = (unsigned char *) getstringvalue(v);
+	for (i = 0; i < c->c_nxentries; i++) {
+		for (k = 0; k < XT_NFIELDS; k++) {
+			x = c->c_xtable[i].x_field[k];
+			for (j = 0; j < 4; j++) {
+				*p++ = x & 0xff;
+				x >>= 8;
+			}
+		}
+	}
+	return v;
 }
 
 /* Handle constants and names uniformly */
@@ -246,7 +412,7 @@ com_add(c, list, v)
 	object *list;
 	object *v;
 {
-	/* XXX Should look through list for object with same value */
+	/* Equal values are merged by com_optimize() */
 	int i = getlistsize(list);
 	if (addlistitem(list, v) != 0)
 		c->c_errors++;
@@ -299,15 +465,56 @@ static object *
 parsenumber(s)
 	char *s;
 {
-	extern long strtol();
-	extern double atof();
-	char *end = s;
-	long x;
-	x = strtol(s, &end, 0);
-	if (*end == '\0')
-		return newintobject(x);
-	if (*end == '.' || *end == 'e' || *end == 'E')
-		return newfloatobject(atof(s));
+	char *p, *end;
+	register unsigned long x, d;
+	unsigned long maxlong = ~(unsigned long)0 >> 1;
+	int base = 10, ovf = 0;
+	double dx;
+	/* Integers, decimal, octal or hex, are converted inline (or by
+	   long_scan() if they are too large); floats go through
+	   parsefloat() */
+	p = s;
+	if (s[0] == '0' && (s[1] == 'x' || s[1] == 'X')) {
+		base = 16;
+		p += 2;
+	}
+	else {
+		for (end = s; *end >= '0' && *end <= '9'; end++)
+			;
+		if (*end == '.' || *end == 'e' || *end == 'E') {
+			dx = parsefloat(s, &end);
+			if (*end == '\0')
+				return newfloatobject(dx);
+			p = NULL;
+		}
+		else if (s[0] == '0' && s[1] != '\0') {
+			base = 8;
+			p++;
+		}
+	}
+	if (p != NULL) {
+		x = 0;
+		for (end = p; ; end++) {
+			if (*end >= '0' && *end <= '9')
+				d = *end - '0';
+			else if (*end >= 'a' && *end <= 'f')
+				d = *end - 'a' + 10;
+			else if (*end >= 'A' && *end <= 'F')
+				d = *end - 'A' + 10;
+			else
+				break;
+			if (d >= base)
+				break;
+			if (x > (maxlong - d) / base)
+				ovf = 1;
+			x = x*base + d;
+		}
+		if (end > p && *end == '\0') {
+			if (ovf)
+				return long_scan(p, (char **)NULL, base);
+			return newintobject((long) x);
+		}
+	}
 	err_setstr(RuntimeError, "bad number syntax");
 	return NULL;
 }
@@ -387,9 +594,12 @@ com_list_constructor(c, n)
 {
 	int len;
 	int i;
-	object *v, *w;
-	if (TYPE(n) != testlist)
-		REQ(n, exprlist);
+	if (TYPE(n) != testlist && TYPE(n) != exprlist) {
+		/* A single item */
+		com_node(c, n);
+		com_addoparg(c, BUILD_LIST, 1);
+		return;
+	}
 	/* exprlist: expr (',' expr)* [',']; likewise for testlist */
 	len = (NCH(n) + 1) / 2;
 	for (i = 0; i < NCH(n); i += 2)
@@ -425,7 +635,7 @@ com_atom(c, n)
 		break;
 	case BACKQUOTE:
 		com_node(c, CHILD(n, 1));
-		com_addbyte(c, UNARY_CONVERT);
+		com_addop(c, UNARY_CONVERT);
 		break;
 	case NUMBER:
 		if ((v = parsenumber(STR(ch))) == NULL) {
@@ -466,22 +676,22 @@ com_slice(c, n, op)
 	int op;
 {
 	if (NCH(n) == 1) {
-		com_addbyte(c, op);
+		com_addop(c, op);
 	}
 	else if (NCH(n) == 2) {
 		if (TYPE(CHILD(n, 0)) != COLON) {
 			com_node(c, CHILD(n, 0));
-			com_addbyte(c, op+1);
+			com_addop(c, op+1);
 		}
 		else {
 			com_node(c, CHILD(n, 1));
-			com_addbyte(c, op+2);
+			com_addop(c, op+2);
 		}
 	}
 	else {
 		com_node(c, CHILD(n, 0));
 		com_node(c, CHILD(n, 2));
-		com_addbyte(c, op+3);
+		com_addop(c, op+3);
 	}
 }
 
@@ -490,11 +700,14 @@ com_apply_subscript(c, n)
 	struct compiling *c;
 	node *n;
 {
-	REQ(n, subscript);
-	if (NCH(n) == 1 && TYPE(CHILD(n, 0)) != COLON) {
+	if (TYPE(n) != subscript) {
 		/* It's a single subscript */
+		com_node(c, n);
+		com_addop(c, BINARY_SUBSCR);
+	}
+	else if (NCH(n) == 1 && TYPE(CHILD(n, 0)) != COLON) {
 		com_node(c, CHILD(n, 0));
-		com_addbyte(c, BINARY_SUBSCR);
+		com_addop(c, BINARY_SUBSCR);
 	}
 	else {
 		/* It's a slice: [expr] ':' [expr] */
@@ -502,18 +715,40 @@ com_apply_subscript(c, n)
 	}
 }
 
+/* Compile the arguments of a call and return the number of values
+   pushed: none, the argument, or for f(a, b, ...) the arguments
+   separately.  CALL_FUNCTION and CALL_METHOD pass those to a built-in
+   method that takes an argument array without building a tuple. */
+
+static int
+com_call_args(c, n)
+	struct compiling *c;
+	node *n; /* EITHER testlist OR ')' */
+{
+	int i;
+	if (TYPE(n) == RPAR)
+		return 0;
+	if (TYPE(n) == testlist && NCH(n) >= 3 && NCH(n) % 2 == 1) {
+		for (i = 0; i < NCH(n); i += 2)
+			com_node(c, CHILD(n, i));
+		return (NCH(n) + 1) / 2;
+	}
+	com_node(c, n);
+	return 1;
+}
+
 static void
 com_call_function(c, n)
 	struct compiling *c;
 	node *n; /* EITHER testlist OR ')' */
 {
-	if (TYPE(n) == RPAR) {
-		com_addbyte(c, UNARY_CALL);
-	}
-	else {
-		com_node(c, n);
-		com_addbyte(c, BINARY_CALL);
-	}
+	int nargs = com_call_args(c, n);
+	if (nargs == 0)
+		com_addop(c, UNARY_CALL);
+	else if (nargs == 1)
+		com_addop(c, BINARY_CALL);
+	else
+		com_addoparg(c, CALL_FUNCTION, nargs);
 }
 
 static void
@@ -524,6 +759,31 @@ com_select_member(c, n)
 	com_addopname(c, LOAD_ATTR, n);
 }
 
+/* Compile a call of a method, obj.name(...), given the two trailers.
+   LOAD_METHOD leaves the function and obj on the stack if name is a
+   method of a class member or in the method table of obj's type, so
+   that CALL_METHOD can call it without making a bound method object;
+   otherwise it leaves the attribute and NULL, and CALL_METHOD calls
+   the attribute like BINARY_CALL. */
+
+static int
+is_method_call(n1, n2)
+	node *n1, *n2;
+{
+	return TYPE(CHILD(n1, 0)) == DOT && TYPE(CHILD(n2, 0)) == LPAR;
+}
+
+static void
+com_call_method(c, n1, n2)
+	struct compiling *c;
+	node *n1, *n2; /* trailer: '.' NAME; trailer: '(' [testlist] ')' */
+{
+	REQ(n1, trailer);
+	REQ(n2, trailer);
+	com_addopname(c, LOAD_METHOD, CHILD(n1, 1));
+	com_addoparg(c, CALL_METHOD, com_call_args(c, CHILD(n2, 1)));
+}
+
 static void
 com_apply_trailer(c, n)
 	struct compiling *c;
@@ -555,17 +815,24 @@ com_factor(c, n)
 	int i;
 	REQ(n, factor);
 	if (TYPE(CHILD(n, 0)) == PLUS) {
-		com_factor(c, CHILD(n, 1));
-		com_addbyte(c, UNARY_POSITIVE);
+		com_node(c, CHILD(n, 1));
+		com_addop(c, UNARY_POSITIVE);
 	}
 	else if (TYPE(CHILD(n, 0)) == MINUS) {
-		com_factor(c, CHILD(n, 1));
-		com_addbyte(c, UNARY_NEGATIVE);
+		com_node(c, CHILD(n, 1));
+		com_addop(c, UNARY_NEGATIVE);
 	}
 	else {
 		com_atom(c, CHILD(n, 0));
-		for (i = 1; i < NCH(n); i++)
-			com_apply_trailer(c, CHILD(n, i));
+		for (i = 1; i < NCH(n); i++) {
+			if (i+1 < NCH(n) &&
+				is_method_call(CHILD(n, i), CHILD(n, i+1))) {
+				com_call_method(c, CHILD(n, i), CHILD(n, i+1));
+				i++;
+			}
+			else
+				com_apply_trailer(c, CHILD(n, i));
+		}
 	}
 }
 
@@ -577,9 +844,9 @@ com_term(c, n)
 	int i;
 	int op;
 	REQ(n, term);
-	com_factor(c, CHILD(n, 0));
+	com_node(c, CHILD(n, 0));
 	for (i = 2; i < NCH(n); i += 2) {
-		com_factor(c, CHILD(n, i));
+		com_node(c, CHILD(n, i));
 		switch (TYPE(CHILD(n, i-1))) {
 		case STAR:
 			op = BINARY_MULTIPLY;
@@ -596,7 +863,7 @@ com_term(c, n)
 			c->c_errors++;
 			op = 255;
 		}
-		com_addbyte(c, op);
+		com_addop(c, op);
 	}
 }
 
@@ -608,9 +875,9 @@ com_expr(c, n)
 	int i;
 	int op;
 	REQ(n, expr);
-	com_term(c, CHILD(n, 0));
+	com_node(c, CHILD(n, 0));
 	for (i = 2; i < NCH(n); i += 2) {
-		com_term(c, CHILD(n, i));
+		com_node(c, CHILD(n, i));
 		switch (TYPE(CHILD(n, i-1))) {
 		case PLUS:
 			op = BINARY_ADD;
@@ -624,7 +891,7 @@ com_expr(c, n)
 			c->c_errors++;
 			op = 255;
 		}
-		com_addbyte(c, op);
+		com_addop(c, op);
 	}
 }
 
@@ -671,7 +938,7 @@ com_comparison(c, n)
 	enum cmp_op op;
 	int anchor;
 	REQ(n, comparison); /* comparison: expr (comp_op expr)* */
-	com_expr(c, CHILD(n, 0));
+	com_node(c, CHILD(n, 0));
 	if (NCH(n) == 1)
 		return;
 	
@@ -711,10 +978,10 @@ com_comparison(c, n)
 	anchor = 0;
 	
 	for (i = 2; i < NCH(n); i += 2) {
-		com_expr(c, CHILD(n, i));
+		com_node(c, CHILD(n, i));
 		if (i+2 < NCH(n)) {
-			com_addbyte(c, DUP_TOP);
-			com_addbyte(c, ROT_THREE);
+			com_addop(c, DUP_TOP);
+			com_addop(c, ROT_THREE);
 		}
 		op = cmp_type(CHILD(n, i-1));
 		if (op == BAD) {
@@ -725,7 +992,7 @@ com_comparison(c, n)
 		com_addoparg(c, COMPARE_OP, op);
 		if (i+2 < NCH(n)) {
 			com_addfwref(c, JUMP_IF_FALSE, &anchor);
-			com_addbyte(c, POP_TOP);
+			com_addop(c, POP_TOP);
 		}
 	}
 	
@@ -733,8 +1000,8 @@ com_comparison(c, n)
 		int anchor2 = 0;
 		com_addfwref(c, JUMP_FORWARD, &anchor2);
 		com_backpatch(c, anchor);
-		com_addbyte(c, ROT_TWO);
-		com_addbyte(c, POP_TOP);
+		com_addop(c, ROT_TWO);
+		com_addop(c, POP_TOP);
 		com_backpatch(c, anchor2);
 	}
 }
@@ -746,11 +1013,11 @@ com_not_test(c, n)
 {
 	REQ(n, not_test); /* 'not' not_test | comparison */
 	if (NCH(n) == 1) {
-		com_comparison(c, CHILD(n, 0));
+		com_node(c, CHILD(n, 0));
 	}
 	else {
-		com_not_test(c, CHILD(n, 1));
-		com_addbyte(c, UNARY_NOT);
+		com_node(c, CHILD(n, 1));
+		com_addop(c, UNARY_NOT);
 	}
 }
 
@@ -765,11 +1032,11 @@ com_and_test(c, n)
 	anchor = 0;
 	i = 0;
 	for (;;) {
-		com_not_test(c, CHILD(n, i));
+		com_node(c, CHILD(n, i));
 		if ((i += 2) >= NCH(n))
 			break;
 		com_addfwref(c, JUMP_IF_FALSE, &anchor);
-		com_addbyte(c, POP_TOP);
+		com_addop(c, POP_TOP);
 	}
 	if (anchor)
 		com_backpatch(c, anchor);
@@ -786,11 +1053,11 @@ com_test(c, n)
 	anchor = 0;
 	i = 0;
 	for (;;) {
-		com_and_test(c, CHILD(n, i));
+		com_node(c, CHILD(n, i));
 		if ((i += 2) >= NCH(n))
 			break;
 		com_addfwref(c, JUMP_IF_TRUE, &anchor);
-		com_addbyte(c, POP_TOP);
+		com_addop(c, POP_TOP);
 	}
 	if (anchor)
 		com_backpatch(c, anchor);
@@ -846,7 +1113,7 @@ com_assign_subscript(c, n, assigning)
 	int assigning;
 {
 	com_node(c, n);
-	com_addbyte(c, assigning ? STORE_SUBSCR : DELETE_SUBSCR);
+	com_addop(c, assigning ? STORE_SUBSCR : DELETE_SUBSCR);
 }
 
 static void
@@ -855,7 +1122,6 @@ com_assign_trailer(c, n, assigning)
 	node *n;
 	int assigning;
 {
-	char *name;
 	REQ(n, trailer);
 	switch (TYPE(CHILD(n, 0))) {
 	case LPAR: /* '(' [exprlist] ')' */
@@ -867,8 +1133,10 @@ com_assign_trailer(c, n, assigning)
 		break;
 	case LSQB: /* '[' subscript ']' */
 		n = CHILD(n, 1);
-		REQ(n, subscript); /* subscript: expr | [expr] ':' [expr] */
-		if (NCH(n) > 1 || TYPE(CHILD(n, 0)) == COLON)
+		/* subscript: expr | [expr] ':' [expr] */
+		if (TYPE(n) != subscript)
+			com_assign_subscript(c, n, assigning);
+		else if (NCH(n) > 1 || TYPE(CHILD(n, 0)) == COLON)
 			com_assign_slice(c, n, assigning);
 		else
 			com_assign_subscript(c, CHILD(n, 0), assigning);
@@ -901,6 +1169,13 @@ com_assign_list(c, n, assigning)
 	int assigning;
 {
 	int i;
+	if (TYPE(n) != exprlist && TYPE(n) != testlist) {
+		/* A single item */
+		if (assigning)
+			com_addoparg(c, UNPACK_LIST, 1);
+		com_assign(c, n, assigning);
+		return;
+	}
 	if (assigning)
 		com_addoparg(c, UNPACK_LIST, (NCH(n)+1)/2);
 	for (i = 0; i < NCH(n); i += 2)
@@ -983,7 +1258,15 @@ com_assign(c, n, assigning)
 				int i;
 				com_node(c, CHILD(n, 0));
 				for (i = 1; i+1 < NCH(n); i++) {
-					com_apply_trailer(c, CHILD(n, i));
+					if (i+2 < NCH(n) && is_method_call(
+						CHILD(n, i), CHILD(n, i+1))) {
+						com_call_method(c, CHILD(n, i),
+							CHILD(n, i+1));
+						i++;
+					}
+					else
+						com_apply_trailer(c,
+							CHILD(n, i));
 				} /* NB i is still alive */
 				com_assign_trailer(c,
 						CHILD(n, i), assigning);
@@ -1040,13 +1323,13 @@ com_expr_stmt(c, n)
 	REQ(n, expr_stmt); /* exprlist ('=' exprlist)* NEWLINE */
 	com_node(c, CHILD(n, NCH(n)-2));
 	if (NCH(n) == 2) {
-		com_addbyte(c, PRINT_EXPR);
+		com_addop(c, PRINT_EXPR);
 	}
 	else {
 		int i;
 		for (i = 0; i < NCH(n)-3; i+=2) {
 			if (i+2 < NCH(n)-3)
-				com_addbyte(c, DUP_TOP);
+				com_addop(c, DUP_TOP);
 			com_assign(c, CHILD(n, i), 1/*assign*/);
 		}
 	}
@@ -1061,10 +1344,10 @@ com_print_stmt(c, n)
 	REQ(n, print_stmt); /* 'print' (test ',')* [test] NEWLINE */
 	for (i = 1; i+1 < NCH(n); i += 2) {
 		com_node(c, CHILD(n, i));
-		com_addbyte(c, PRINT_ITEM);
+		com_addop(c, PRINT_ITEM);
 	}
 	if (TYPE(CHILD(n, NCH(n)-2)) != COMMA)
-		com_addbyte(c, PRINT_NEWLINE);
+		com_addop(c, PRINT_NEWLINE);
 }
 
 static void
@@ -1077,7 +1360,7 @@ com_return_stmt(c, n)
 		com_addoparg(c, LOAD_CONST, com_addconst(c, None));
 	else
 		com_node(c, CHILD(n, 1));
-	com_addbyte(c, RETURN_VALUE);
+	com_addop(c, RETURN_VALUE);
 }
 
 static void
@@ -1091,7 +1374,7 @@ com_raise_stmt(c, n)
 		com_node(c, CHILD(n, 3));
 	else
 		com_addoparg(c, LOAD_CONST, com_addconst(c, None));
-	com_addbyte(c, RAISE_EXCEPTION);
+	com_addop(c, RAISE_EXCEPTION);
 }
 
 static void
@@ -1109,7 +1392,7 @@ com_import_stmt(c, n)
 		com_addopname(c, IMPORT_NAME, CHILD(n, 1));
 		for (i = 3; i < NCH(n); i += 2)
 			com_addopname(c, IMPORT_FROM, CHILD(n, i));
-		com_addbyte(c, POP_TOP);
+		com_addop(c, POP_TOP);
 	}
 	else {
 		for (i = 1; i < NCH(n); i += 2) {
@@ -1132,11 +1415,11 @@ com_if_stmt(c, n)
 		int a = 0;
 		com_node(c, CHILD(n, i+1));
 		com_addfwref(c, JUMP_IF_FALSE, &a);
-		com_addbyte(c, POP_TOP);
+		com_addop(c, POP_TOP);
 		com_node(c, CHILD(n, i+3));
 		com_addfwref(c, JUMP_FORWARD, &anchor);
 		com_backpatch(c, a);
-		com_addbyte(c, POP_TOP);
+		com_addop(c, POP_TOP);
 	}
 	if (i+2 < NCH(n))
 		com_node(c, CHILD(n, i+2));
@@ -1148,23 +1431,23 @@ com_while_stmt(c, n)
 	struct compiling *c;
 	node *n;
 {
-	int break_anchor = 0;
+	int block;
 	int anchor = 0;
 	int begin;
 	REQ(n, while_stmt); /* 'while' test ':' suite ['else' ':' suite] */
-	com_addfwref(c, SETUP_LOOP, &break_anchor);
+	block = com_setup(c, XT_LOOP);
 	begin = c->c_nexti;
 	com_node(c, CHILD(n, 1));
 	com_addfwref(c, JUMP_IF_FALSE, &anchor);
-	com_addbyte(c, POP_TOP);
+	com_addop(c, POP_TOP);
 	com_node(c, CHILD(n, 3));
 	com_addoparg(c, JUMP_ABSOLUTE, begin);
 	com_backpatch(c, anchor);
-	com_addbyte(c, POP_TOP);
-	com_addbyte(c, POP_BLOCK);
+	com_addop(c, POP_TOP);
+	com_endblock(c, block, XT_END);
 	if (NCH(n) > 4)
 		com_node(c, CHILD(n, 6));
-	com_backpatch(c, break_anchor);
+	com_endblock(c, block, XT_HANDLER);
 }
 
 static void
@@ -1173,28 +1456,30 @@ com_for_stmt(c, n)
 	node *n;
 {
 	object *v;
-	int break_anchor = 0;
+	int block;
 	int anchor = 0;
 	int begin;
 	REQ(n, for_stmt);
 	/* 'for' exprlist 'in' exprlist ':' suite ['else' ':' suite] */
-	com_addfwref(c, SETUP_LOOP, &break_anchor);
+	block = com_setup(c, XT_LOOP);
 	com_node(c, CHILD(n, 3));
 	v = newintobject(0L);
 	if (v == NULL)
 		c->c_errors++;
 	com_addoparg(c, LOAD_CONST, com_addconst(c, v));
 	XDECREF(v);
+	c->c_level += 2; /* The sequence and the index */
 	begin = c->c_nexti;
 	com_addfwref(c, FOR_LOOP, &anchor);
 	com_assign(c, CHILD(n, 1), 1/*assigning*/);
 	com_node(c, CHILD(n, 5));
 	com_addoparg(c, JUMP_ABSOLUTE, begin);
+	c->c_level -= 2;
 	com_backpatch(c, anchor);
-	com_addbyte(c, POP_BLOCK);
+	com_endblock(c, block, XT_END);
 	if (NCH(n) > 8)
 		com_node(c, CHILD(n, 8));
-	com_backpatch(c, break_anchor);
+	com_endblock(c, block, XT_HANDLER);
 }
 
 static void
@@ -1202,58 +1487,58 @@ com_try_stmt(c, n)
 	struct compiling *c;
 	node *n;
 {
-	int finally_anchor = 0;
-	int except_anchor = 0;
+	int have_finally, have_except;
+	int finally_block = -1, except_block = -1;
 	REQ(n, try_stmt);
 	/* 'try' ':' suite (except_clause ':' suite)* ['finally' ':' suite] */
-	if (NCH(n) > 3 && TYPE(CHILD(n, NCH(n)-3)) != except_clause) {
-		/* Have a 'finally' clause */
-		com_addfwref(c, SETUP_FINALLY, &finally_anchor);
-	}
-	if (NCH(n) > 3 && TYPE(CHILD(n, 3)) == except_clause) {
-		/* Have an 'except' clause */
-		com_addfwref(c, SETUP_EXCEPT, &except_anchor);
-	}
+	have_finally = NCH(n) > 3 && TYPE(CHILD(n, NCH(n)-3)) != except_clause;
+	have_except = NCH(n) > 3 && TYPE(CHILD(n, 3)) == except_clause;
+	if (have_finally)
+		finally_block = com_setup(c, XT_FINALLY);
+	if (have_except)
+		except_block = com_setup(c, XT_EXCEPT);
 	com_node(c, CHILD(n, 2));
-	if (except_anchor) {
+	if (have_except) {
 		int end_anchor = 0;
 		int i;
 		node *ch;
-		com_addbyte(c, POP_BLOCK);
+		com_endblock(c, except_block, XT_END);
 		com_addfwref(c, JUMP_FORWARD, &end_anchor);
-		com_backpatch(c, except_anchor);
+		com_endblock(c, except_block, XT_HANDLER);
 		for (i = 3;
 			i < NCH(n) && TYPE(ch = CHILD(n, i)) == except_clause;
 								i += 3) {
 			/* except_clause: 'except' [expr [',' expr]] */
 			int next_anchor = 0;
 			if (NCH(ch) > 1) {
-				com_addbyte(c, DUP_TOP);
+				com_addop(c, DUP_TOP);
 				com_node(c, CHILD(ch, 1));
 				com_addoparg(c, COMPARE_OP, EXC_MATCH);
 				com_addfwref(c, JUMP_IF_FALSE, &next_anchor);
-				com_addbyte(c, POP_TOP);
+				com_addop(c, POP_TOP);
 			}
-			com_addbyte(c, POP_TOP);
+			com_addop(c, POP_TOP);
 			if (NCH(ch) > 3)
 				com_assign(c, CHILD(ch, 3), 1/*assigning*/);
 			else
-				com_addbyte(c, POP_TOP);
+				com_addop(c, POP_TOP);
 			com_node(c, CHILD(n, i+2));
 			com_addfwref(c, JUMP_FORWARD, &end_anchor);
 			if (next_anchor)
 				com_backpatch(c, next_anchor);
 		}
-		com_addbyte(c, END_FINALLY);
+		com_addop(c, END_FINALLY);
 		com_backpatch(c, end_anchor);
 	}
-	if (finally_anchor) {
-		com_addbyte(c, POP_BLOCK);
+	if (have_finally) {
+		com_endblock(c, finally_block, XT_END);
 		com_addoparg(c, LOAD_CONST, com_addconst(c, None));
 		com_addoparg(c, LOAD_CONST, com_addconst(c, None));
-		com_backpatch(c, finally_anchor);
+		com_endblock(c, finally_block, XT_HANDLER);
+		c->c_level += 2; /* The exception and its value */
 		com_node(c, CHILD(n, NCH(n)-1));
-		com_addbyte(c, END_FINALLY);
+		c->c_level -= 2;
+		com_addop(c, END_FINALLY);
 	}
 }
 
@@ -1271,7 +1556,7 @@ com_suite(c, n)
 		int i;
 		for (i = 0; i < NCH(n); i++) {
 			node *ch = CHILD(n, i);
-			if (TYPE(ch) == stmt)
+			if (ISNONTERMINAL(TYPE(ch))) /* stmt */
 				com_node(c, ch);
 		}
 	}
@@ -1290,7 +1575,7 @@ com_funcdef(c, n)
 	else {
 		int i = com_addconst(c, v);
 		com_addoparg(c, LOAD_CONST, i);
-		com_addbyte(c, BUILD_FUNCTION);
+		com_addop(c, BUILD_FUNCTION);
 		com_addopname(c, STORE_NAME, CHILD(n, 1));
 		DECREF(v);
 	}
@@ -1327,7 +1612,7 @@ com_node(c, n)
 		com_classdef(c, n);
 		break;
 	
-	/* Trivial parse tree nodes */
+	/* Trivial parse tree nodes (only in trees that aren't compact) */
 	
 	case stmt:
 	case simple_stmt:
@@ -1350,7 +1635,7 @@ com_node(c, n)
 	case pass_stmt:
 		break;
 	case break_stmt:
-		com_addbyte(c, BREAK_LOOP);
+		com_addop(c, BREAK_LOOP);
 		break;
 	case return_stmt:
 		com_return_stmt(c, n);
@@ -1436,6 +1721,10 @@ com_fplist(c, n)
 	struct compiling *c;
 	node *n;
 {
+	if (TYPE(n) == fpdef) {
+		com_fpdef(c, n);
+		return;
+	}
 	REQ(n, fplist); /* fplist: fpdef (',' fpdef)* */
 	if (NCH(n) == 1) {
 		com_fpdef(c, CHILD(n, 0));
@@ -1474,14 +1763,14 @@ compile_funcdef(c, n)
 	ch = CHILD(n, 2); /* parameters: '(' [fplist] ')' */
 	ch = CHILD(ch, 1); /* ')' | fplist */
 	if (TYPE(ch) == RPAR)
-		com_addbyte(c, REFUSE_ARGS);
+		com_addop(c, REFUSE_ARGS);
 	else {
-		com_addbyte(c, REQUIRE_ARGS);
+		com_addop(c, REQUIRE_ARGS);
 		com_fplist(c, ch);
 	}
 	com_node(c, CHILD(n, 4));
 	com_addoparg(c, LOAD_CONST, com_addconst(c, None));
-	com_addbyte(c, RETURN_VALUE);
+	com_addop(c, RETURN_VALUE);
 }
 
 static void
@@ -1502,6 +1791,11 @@ compile_node(c, n)
 		com_file_input(c, n);
 		break;
 	
+	case stmt:
+		/* One statement of a file_input (see parsestmt()) */
+		com_node(c, n);
+		break;
+	
 	case expr_input:
 	case eval_input:
 		com_node(c, CHILD(n, 0));
@@ -1518,20 +1812,541 @@ compile_node(c, n)
 	}
 }
 
+/* Peephole optimizer.
+
+   When optimizing is set (the default), the finished code of every
+   code object is decoded into an array of instructions and rewritten:
+
+   - a jump to an unconditional jump goes to the latter's target
+     directly, and so does a JUMP_IF_... to a JUMP_IF_... with the
+     same test (the tested value is still on the stack); only
+     JUMP_ABSOLUTE checks for interrupts, so it is never skipped
+     (see threadjump());
+   - code that follows a RETURN_VALUE, BREAK_LOOP, RAISE_EXCEPTION or
+     unconditional jump and is not a jump target or handler is
+     removed, and so are JUMP_FORWARDs to the next instruction;
+   - operators applied to constant numbers, and + and * applied to
+     short constant strings, are computed once; if that fails (e.g.
+     division by zero) the code is left alone and the error happens at
+     run time;
+   - the constant and name lists are rebuilt with only the entries
+     that are used, each value appearing once;
+   - the instructions are laid out again with just enough EXTENDED_ARG
+     prefixes.
+
+   If anything unexpected is found the code is left as it is. */
+
+int optimizing = 1;
+
+#define NOARG	(-1)		/* i_target of instructions that aren't jumps */
+#define SENTINEL (-1)		/* i_op of the end of the code */
+#define FOLDLIMIT 20		/* Longest string made by constant folding */
+
+struct instr {
+	int i_op;
+	long i_arg;
+	int i_target;		/* Index of jump target, or NOARG */
+	int i_label;		/* Set if the instruction is a jump target */
+	int i_bound;		/* Set if a block starts or ends here */
+	long i_offset;		/* Offset in the new code */
+};
+
+static int
+isjump(op)
+	int op;
+{
+	switch (op) {
+	case JUMP_FORWARD:
+	case JUMP_IF_FALSE:
+	case JUMP_IF_TRUE:
+	case JUMP_ABSOLUTE:
+	case FOR_LOOP:
+		return 1;
+	}
+	return 0;
+}
+
+static int
+hasname(op)
+	int op;
+{
+	switch (op) {
+	case STORE_NAME:
+	case DELETE_NAME:
+	case STORE_ATTR:
+	case DELETE_ATTR:
+	case LOAD_NAME:
+	case LOAD_ATTR:
+	case LOAD_METHOD:
+	case IMPORT_NAME:
+	case IMPORT_FROM:
+		return 1;
+	}
+	return 0;
+}
+
+static int
+isnumber(v)
+	object *v;
+{
+	return is_intobject(v) || is_longobject(v) || is_floatobject(v);
+}
+
+/* Compute a constant operator; NULL if it can't be done */
+
+static object *
+fold(op, v, w)
+	int op;
+	object *v, *w;
+{
+	number_methods *nb;
+	object *x;
+	if (w == NULL) {
+		if (!isnumber(v))
+			return NULL;
+		nb = v->ob_type->tp_as_number;
+		x = (*(op == UNARY_NEGATIVE ?
+				nb->nb_negative : nb->nb_positive))(v);
+	}
+	else if (isnumber(v) && isnumber(w)) {
+		if (is_floatobject(v) != is_floatobject(w))
+			return NULL; /* Mixed arithmetic is a run-time error */
+		nb = v->ob_type->tp_as_number;
+		switch (op) {
+		case BINARY_ADD:	x = (*nb->nb_add)(v, w); break;
+		case BINARY_SUBTRACT:	x = (*nb->nb_subtract)(v, w); break;
+		case BINARY_MULTIPLY:	x = (*nb->nb_multiply)(v, w); break;
+		case BINARY_DIVIDE:	x = (*nb->nb_divide)(v, w); break;
+		case BINARY_MODULO:	x = (*nb->nb_remainder)(v, w); break;
+		default:		return NULL;
+		}
+	}
+	else if (op == BINARY_ADD && is_stringobject(v) && is_stringobject(w)) {
+		if (getstringsize(v) + getstringsize(w) > FOLDLIMIT)
+			return NULL;
+		x = (*v->ob_type->tp_as_sequence->sq_concat)(v, w);
+	}
+	else if (op == BINARY_MULTIPLY &&
+			(is_stringobject(v) && is_intobject(w) ||
+			 is_intobject(v) && is_stringobject(w))) {
+		long n;
+		if (is_intobject(v)) {
+			object *tmp = v;
+			v = w;
+			w = tmp;
+		}
+		n = getintvalue(w);
+		if (n > FOLDLIMIT ||
+			n > 0 && getstringsize(v) * n > FOLDLIMIT)
+			return NULL;
+		x = (*v->ob_type->tp_as_sequence->sq_repeat)(v, (int)n);
+	}
+	else
+		return NULL;
+	if (x == NULL)
+		err_clear();
+	return x;
+}
+
+/* Hash index used to find equal constants and names */
+
+static long
+consthash(v)
+	object *v;
+{
+	unsigned long h = 0;
+	unsigned char *p = NULL;
+	int i, size = 0;
+	if (is_stringobject(v)) {
+		p = (unsigned char *) getstringvalue(v);
+		size = getstringsize(v);
+	}
+	else if (is_intobject(v))
+		h = getintvalue(v);
+	else if (is_floatobject(v)) {
+		p = (unsigned char *) &((floatobject *)v)->ob_fval;
+		size = sizeof(double);
+	}
+	else if (is_longobject(v)) {
+		p = (unsigned char *) ((longobject *)v)->ob_digit;
+		size = ((longobject *)v)->ob_size * sizeof(digit);
+		h = ((longobject *)v)->ob_neg;
+	}
+	else
+		h = (unsigned long) v;
+	for (i = 0; i < size; i++)
+		h = h*31 + p[i];
+	return h;
+}
+
+static int
+sameconst(v, w)
+	object *v, *w;
+{
+	if (v == w)
+		return 1;
+	if (v->ob_type != w->ob_type)
+		return 0;
+	if (is_floatobject(v)) /* Tell 0.0 and -0.0 apart */
+		return memcmp((char *) &((floatobject *)v)->ob_fval,
+			(char *) &((floatobject *)w)->ob_fval,
+			sizeof(double)) == 0;
+	if (is_stringobject(v) || is_intobject(v) || is_longobject(v))
+		return cmpobject(v, w) == 0;
+	return 0;
+}
+
+struct index {
+	object *x_list;		/* The values, each appearing once */
+	int *x_table;		/* Open hash table of list index + 1 */
+	int x_mask;		/* Table size - 1 */
+};
+
+static int
+newindex(x, size)
+	struct index *x;
+	int size;
+{
+	int i;
+	for (x->x_mask = 7; x->x_mask < 2*size; x->x_mask = 2*x->x_mask + 1)
+		;
+	x->x_table = NEW(int, x->x_mask + 1);
+	x->x_list = newlistobject(0);
+	if (x->x_table == NULL || x->x_list == NULL) {
+		XDEL(x->x_table);
+		XDECREF(x->x_list);
+		return 0;
+	}
+	for (i = 0; i <= x->x_mask; i++)
+		x->x_table[i] = 0;
+	return 1;
+}
+
+/* Return the index of v in the list, adding it if necessary.
+   The table has room for all values that will be added. */
+
+static int
+lookindex(x, v)
+	struct index *x;
+	object *v;
+{
+	int i, k;
+	for (i = consthash(v) & x->x_mask; (k = x->x_table[i]) != 0;
+						i = (i+1) & x->x_mask) {
+		if (sameconst(v, getlistitem(x->x_list, k-1)))
+			return k-1;
+	}
+	k = getlistsize(x->x_list);
+	if (addlistitem(x->x_list, v) != 0) {
+		err_clear();
+		return -1;
+	}
+	x->x_table[i] = k+1;
+	return k;
+}
+
+/* Follow the chain of jumps starting at instruction i.
+   Only JUMP_ABSOLUTE checks for interrupts, so a loop must keep one:
+   a JUMP_FORWARD threaded through it becomes a JUMP_ABSOLUTE, and a
+   conditional jump stops there. */
+
+static int
+threadjump(code, i)
+	struct instr *code;
+	int i;
+{
+	int op = code[i].i_op;
+	int t = code[i].i_target;
+	int n;
+	for (n = 0; n < 100; n++) { /* Don't loop forever */
+		int op2 = code[t].i_op;
+		if (op2 == JUMP_ABSOLUTE && op == JUMP_FORWARD)
+			code[i].i_op = op = JUMP_ABSOLUTE;
+		if (op2 == JUMP_FORWARD ||
+				op2 == JUMP_ABSOLUTE && op == JUMP_ABSOLUTE)
+			t = code[t].i_target;
+		else if (op2 == op &&
+				(op == JUMP_IF_FALSE || op == JUMP_IF_TRUE))
+			t = code[t].i_target;
+		else if (op == JUMP_IF_FALSE && op2 == JUMP_IF_TRUE ||
+				op == JUMP_IF_TRUE && op2 == JUMP_IF_FALSE)
+			t = t+1;
+		else
+			break;
+	}
+	return t;
+}
+
+/* Compute the offsets of the instructions in the new code */
+
+static long
+layout(code, n)
+	struct instr *code;
+	int n;
+{
+	long offset, arg, size;
+	int i, changed;
+	for (i = 0; i < n; i++)
+		code[i].i_offset = 0;
+	/* Offsets only grow, so this stops */
+	do {
+		changed = 0;
+		offset = 0;
+		for (i = 0; i < n; i++) {
+			if (code[i].i_offset != offset) {
+				code[i].i_offset = offset;
+				changed = 1;
+			}
+			arg = code[i].i_arg;
+			if (code[i].i_target != NOARG)
+				arg = code[code[i].i_target].i_offset;
+			for (size = 2; (unsigned long)arg >> 8 != 0; size += 2)
+				arg = (unsigned long)arg >> 8;
+			offset += size;
+		}
+		code[n].i_offset = offset;
+	} while (changed);
+	return offset;
+}
+
+static void
+com_optimize(c)
+	struct compiling *c;
+{
+	unsigned char *p;
+	struct instr *code;
+	int *index;
+	int *xt;
+	struct index consts, names;
+	object *v, *w;
+	long arg;
+	int len, n, m, i, k, op, dead;
+	
+	/* Decode the code; index maps offsets to instruction numbers */
+	p = (unsigned char *) getstringvalue(c->c_code);
+	len = c->c_nexti;
+	code = NEW(struct instr, len/2 + 1);
+	index = NEW(int, len/2 + 1);
+	xt = NEW(int, 3*c->c_nxentries + 1);
+	if (code == NULL || index == NULL || xt == NULL)
+		goto done;
+	for (i = 0; i <= len/2; i++)
+		index[i] = -1;
+	n = 0;
+	for (i = 0; i < len; ) {
+		index[i/2] = n;
+		arg = 0;
+		while (i < len && p[i] == EXTENDED_ARG) {
+			arg = arg << 8 | p[i+1];
+			i += 2;
+		}
+		if (i >= len)
+			goto done;
+		code[n].i_op = p[i];
+		code[n].i_arg = arg << 8 | p[i+1];
+		code[n].i_label = 0;
+		code[n].i_bound = 0;
+		i += 2;
+		n++;
+	}
+	index[len/2] = n;
+	code[n].i_op = SENTINEL;
+	code[n].i_target = NOARG;
+	code[n].i_label = 1;
+	code[n].i_bound = 0;
+	for (i = 0; i < n; i++) {
+		code[i].i_target = NOARG;
+		if (isjump(code[i].i_op)) {
+			arg = code[i].i_arg;
+			if (arg < 0 || arg > len || arg%2 != 0 ||
+						index[arg/2] < 0)
+				goto done;
+			code[i].i_target = index[arg/2];
+		}
+	}
+	
+	/* Copy the block boundaries and handlers of the exception table
+	   as instruction numbers to xt */
+	for (i = 0; i < c->c_nxentries; i++) {
+		for (k = 0; k < 3; k++) {
+			arg = c->c_xtable[i].x_field[XT_START + k];
+			if (arg < 0 || arg > len || arg%2 != 0 ||
+						index[arg/2] < 0)
+				goto done;
+			xt[3*i + k] = index[arg/2];
+		}
+	}
+	
+	/* Thread jumps, then find out which instructions are targets */
+	for (i = 0; i < n; i++) {
+		if (code[i].i_target != NOARG)
+			code[i].i_target = threadjump(code, i);
+	}
+	for (i = 0; i < n; i++) {
+		if (code[i].i_target != NOARG)
+			code[code[i].i_target].i_label = 1;
+	}
+	for (i = 0; i < c->c_nxentries; i++) {
+		code[xt[3*i]].i_bound = 1;
+		code[xt[3*i + 1]].i_bound = 1;
+		code[xt[3*i + 2]].i_label = 1;
+	}
+	
+	/* Remove dead code and fold constants, compacting the array;
+	   index now maps old instruction numbers to new ones, which is
+	   only needed for jump targets and block boundaries */
+	m = 0;
+	dead = 0;
+	for (i = 0; i <= n; i++) {
+		if (code[i].i_label) {
+			dead = 0;
+			/* A JUMP_ABSOLUTE to the next instruction stays,
+			   for its interrupt check */
+			while (m > 0 && code[m-1].i_target == i &&
+					code[m-1].i_op == JUMP_FORWARD)
+				m--; /* Jump to the next instruction */
+		}
+		index[i] = m;
+		if (dead)
+			continue;
+		code[m++] = code[i];
+		op = code[i].i_op;
+		switch (op) {
+		case UNARY_NEGATIVE:
+		case UNARY_POSITIVE:
+			if (m < 2 || code[m-2].i_op != LOAD_CONST ||
+					code[m-1].i_label || code[m-1].i_bound)
+				break;
+			v = getlistitem(c->c_consts, (int)code[m-2].i_arg);
+			if ((v = fold(op, v, (object *)NULL)) == NULL)
+				break;
+			code[m-2].i_arg = com_addconst(c, v);
+			DECREF(v);
+			m--;
+			break;
+		case BINARY_ADD:
+		case BINARY_SUBTRACT:
+		case BINARY_MULTIPLY:
+		case BINARY_DIVIDE:
+		case BINARY_MODULO:
+			if (m < 3 || code[m-3].i_op != LOAD_CONST ||
+					code[m-2].i_op != LOAD_CONST ||
+					code[m-2].i_label || code[m-1].i_label ||
+					code[m-2].i_bound || code[m-1].i_bound)
+				break;
+			v = getlistitem(c->c_consts, (int)code[m-3].i_arg);
+			w = getlistitem(c->c_consts, (int)code[m-2].i_arg);
+			if ((v = fold(op, v, w)) == NULL)
+				break;
+			code[m-3].i_arg = com_addconst(c, v);
+			DECREF(v);
+			m -= 2;
+			break;
+		case RETURN_VALUE:
+		case BREAK_LOOP:
+		case RAISE_EXCEPTION:
+		case JUMP_FORWARD:
+		case JUMP_ABSOLUTE:
+			dead = 1;
+			break;
+		}
+	}
+	n = m-1; /* Drop the sentinel */
+	for (i = 0; i < n; i++) {
+		if (code[i].i_target != NOARG)
+			code[i].i_target = index[code[i].i_target];
+	}
+	for (i = 0; i < 3*c->c_nxentries; i++)
+		xt[i] = index[xt[i]];
+	
+	/* Rebuild the constant and name lists */
+	if (c->c_errors != 0 ||
+		!newindex(&consts, getlistsize(c->c_consts)))
+		goto done;
+	if (!newindex(&names, getlistsize(c->c_names))) {
+		DEL(consts.x_table);
+		DECREF(consts.x_list);
+		goto done;
+	}
+	for (i = 0; i < n; i++) {
+		op = code[i].i_op;
+		k = 0;
+		if (op == LOAD_CONST)
+			k = lookindex(&consts,
+				getlistitem(c->c_consts, (int)code[i].i_arg));
+		else if (hasname(op))
+			k = lookindex(&names,
+				getlistitem(c->c_names, (int)code[i].i_arg));
+		if (k < 0)
+			break;
+		if (op == LOAD_CONST || hasname(op))
+			code[i].i_arg = k;
+	}
+	DEL(consts.x_table);
+	DEL(names.x_table);
+	if (i < n) {
+		DECREF(consts.x_list);
+		DECREF(names.x_list);
+		goto done;
+	}
+	DECREF(c->c_consts);
+	c->c_consts = consts.x_list;
+	DECREF(c->c_names);
+	c->c_names = names.x_list;
+	
+	/* Write the new code over the old */
+	layout(code, n);
+	c->c_nexti = 0;
+	for (i = 0; i < n; i++) {
+		arg = code[i].i_arg;
+		if (code[i].i_target != NOARG)
+			arg = code[code[i].i_target].i_offset;
+		com_addoparg(c, code[i].i_op, (int)arg);
+	}
+	com_done(c);
+	for (i = 0; i < c->c_nxentries; i++) {
+		for (k = 0; k < 3; k++)
+			c->c_xtable[i].x_field[XT_START + k] =
+						code[xt[3*i + k]].i_offset;
+	}
+	
+  done:
+	XDEL(code);
+	XDEL(index);
+	XDEL(xt);
+}
+
 codeobject *
 compile(n)
 	node *n;
 {
 	struct compiling sc;
 	codeobject *co;
-	if (!com_init(&sc))
-		return NULL;
-	compile_node(&sc, n);
-	com_done(&sc);
-	if (sc.c_errors == 0)
-		co = newcodeobject(sc.c_code, sc.c_consts, sc.c_names);
-	else
-		co = NULL;
+	int fwdext = 0;
+	for (;;) {
+		if (!com_init(&sc))
+			return NULL;
+		sc.c_fwdext = fwdext;
+		compile_node(&sc, n);
+		com_done(&sc);
+		if (!sc.c_retry || sc.c_errors != 0)
+			break;
+		/* A forward jump was too long; make room for another
+		   byte in all of them */
+		com_free(&sc);
+		fwdext++;
+	}
+	if (sc.c_errors == 0 && optimizing)
+		com_optimize(&sc);
+	co = NULL;
+	if (sc.c_errors == 0) {
+		object *xtable = com_xtable(&sc);
+		if (xtable != NULL) {
+			co = newcodeobject(sc.c_code, sc.c_consts, sc.c_names,
+									xtable);
+			DECREF(xtable);
+		}
+	}
 	com_free(&sc);
 	return co;
 }
@@ -0,0 +1,137 @@
+/* Freeze program: write a frozen modules table (see frozen.h) */
+
+/*
+Usage: freeze file.py ... >frozen.c
+
+Each file is parsed and compiled, and its code object is marshalled
+into a C array after the magic word of compile.h.  The module name is the file name without directory
+and ".py" suffix.  Link the output with the interpreter in place of
+Python/frozen.c, e.g.:
+
+	freeze Lib/string.py Lib/stat.py Lib/posixpath.py >frozen.c
+
+The program is linked with the same parser, compiler and marshal code
+as the interpreter, so its output must be regenerated when the
+bytecode or the marshal format changes.
+*/
+
+#include <stdio.h>
+#include "string.h"
+
+#include "PROTO.h"
+#include "grammar.h"
+#include "node.h"
+#include "parsetok.h"
+#include "graminit.h"
+#include "errcode.h"
+#include "object.h"
+#include "stringobject.h"
+#include "compile.h"
+#include "marshal.h"
+
+extern grammar gram; /* From graminit.c */
+
+#define MAXNAME 100
+
+/* Write the marshalled code of one module as a C array */
+
+static int
+freeze(filename, name, out)
+	char *filename;
+	char *name;
+	FILE *out;
+{
+	FILE *fp, *tmp;
+	node *n;
+	codeobject *co;
+	int c, size;
+
+	fp = fopen(filename, "r");
+	if (fp == NULL) {
+		perror(filename);
+		return -1;
+	}
+	n = NULL;
+	if (parsefile(fp, &gram, file_input, (char *)NULL, (char *)NULL, &n)
+								!= E_DONE) {
+		fprintf(stderr, "%s: syntax error\n", filename);
+		fclose(fp);
+		return -1;
+	}
+	fclose(fp);
+	co = compile(n);
+	freetree(n);
+	if (co == NULL) {
+		fprintf(stderr, "%s: compilation failed\n", filename);
+		return -1;
+	}
+	tmp = tmpfile();
+	if (tmp == NULL) {
+		perror("tmpfile");
+		return -1;
+	}
+	wr_long(MAGIC, tmp);
+	if (wr_object((object *)co, tmp) != 0) {
+		fprintf(stderr, "%s: cannot marshal code\n", filename);
+		DECREF(co);
+		fclose(tmp);
+		return -1;
+	}
+	DECREF(co);
+	rewind(tmp);
+	fprintf(out, "static unsigned char M_%s[] = {", name);
+	for (size = 0; (c = getc(tmp)) != EOF; size++) {
+		if (size % 16 == 0)
+			fprintf(out, "\n\t");
+		fprintf(out, "%d,", c);
+	}
+	fprintf(out, "\n};\n\n");
+	fclose(tmp);
+	return size;
+}
+
+main(argc, argv)
+	int argc;
+	char **argv;
+{
+	char names[MAXNAME][100];
+	int sizes[MAXNAME];
+	int i, n;
+	char *p, *q;
+
+	if (argc < 2 || argc-1 > MAXNAME) {
+		fprintf(stderr, "usage: %s file.py ... >frozen.c\n", argv[0]);
+		exit(2);
+	}
+	printf("/* Frozen modules table, written by freeze -- don't edit */\n\n");
+	printf("#include \"frozen.h\"\n\n");
+	n = 0;
+	for (i = 1; i < argc; i++) {
+		p = strrchr(argv[i], '/');
+		p = p == NULL ? argv[i] : p+1;
+		q = strrchr(p, '.');
+		if (q == NULL || strcmp(q, ".py") != 0 || q - p >= 100) {
+			fprintf(stderr, "%s: not a module (*.py)\n", argv[i]);
+			exit(2);
+		}
+		strncpy(names[n], p, q - p);
+		names[n][q - p] = '\0';
+		if ((sizes[n] = freeze(argv[i], names[n], stdout)) < 0)
+			exit(1);
+		n++;
+	}
+	printf("struct frozen frozen_modules[] = {\n");
+	for (i = 0; i < n; i++)
+		printf("\t{\"%s\", M_%s, %d},\n", names[i], names[i], sizes[i]);
+	printf("\t{0, 0, 0}\t/* sentinel */\n");
+	printf("};\n");
+	exit(0);
+}
+
+void
+fatal(msg)
+	char *msg;
+{
+	fprintf(stderr, "freeze: FATAL ERROR: %s\n", msg);
+	exit(1);
+}
@@ -0,0 +1,9 @@
+/* Table of frozen modules.
+   This is the default, empty version; to embed modules in the
+   interpreter, link with the output of the freeze program instead. */
+
+#include "frozen.h"
+
+struct frozen frozen_modules[] = {
+	{0, 0, 0}	/* sentinel */
+};
@@ -11,10 +11,26 @@ static arc arcs_0_1[1] = {
 static arc arcs_0_2[1] = {
 	{2, 1},
 };
+static const short accel_0_0[87] = {
+	1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, 4994, 2433, -1, -1, -1, 2433,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, 2433, -1, 2433, 2433,
+	-1, -1, -1, 2433, 2433, 2433, -1, 2433,
+	2433, -1, -1, -1, -1, -1, -1, 4994,
+	-1, -1, 4994, 4994, -1, 4994, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, 2433, 2433,
+	-1, -1, -1, -1, -1, 2433, -1, 2433,
+	-1, 2433, 2433, 2433, -1, -1, 4994,
+};
+static const short accel_0_2[1] = {
+	1,
+};
 static state states_0[3] = {
-	{3, arcs_0_0},
-	{1, arcs_0_1},
-	{1, arcs_0_2},
+	{3, arcs_0_0, 2, 89, accel_0_0, 0},
+	{1, arcs_0_1, 0, 0, 0, 1},
+	{1, arcs_0_2, 2, 3, accel_0_2, 0},
 };
 static arc arcs_1_0[3] = {
 	{2, 0},
@@ -24,9 +40,22 @@ static arc arcs_1_0[3] = {
 static arc arcs_1_1[1] = {
 	{0, 1},
 };
+static const short accel_1_0[87] = {
+	0, -1, -1, -1, -1, 1, -1, -1,
+	-1, -1, 2176, 2176, -1, -1, -1, 2176,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, 2176, -1, 2176, 2176,
+	-1, -1, -1, 2176, 2176, 2176, -1, 2176,
+	2176, -1, -1, -1, -1, -1, -1, 2176,
+	-1, -1, 2176, 2176, -1, 2176, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, 2176, 2176,
+	-1, -1, -1, -1, -1, 2176, -1, 2176,
+	-1, 2176, 2176, 2176, -1, -1, 2176,
+};
 static state states_1[2] = {
-	{3, arcs_1_0},
-	{1, arcs_1_1},
+	{3, arcs_1_0, 2, 89, accel_1_0, 0},
+	{1, arcs_1_1, 0, 0, 0, 1},
 };
 static arc arcs_2_0[1] = {
 	{9, 1},
@@ -37,10 +66,25 @@ static arc arcs_2_1[1] = {
 static arc arcs_2_2[1] = {
 	{0, 2},
 };
+static const short accel_2_0[73] = {
+	9857, -1, -1, -1, 9857, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, 9857, -1, -1, -1,
+	-1, -1, -1, 9857, 9857, -1, -1, -1,
+	-1, -1, 9857, -1, 9857, -1, 9857, 9857,
+	9857,
+};
+static const short accel_2_1[1] = {
+	2,
+};
 static state states_2[3] = {
-	{1, arcs_2_0},
-	{1, arcs_2_1},
-	{1, arcs_2_2},
+	{1, arcs_2_0, 13, 86, accel_2_0, 0},
+	{1, arcs_2_1, 2, 3, accel_2_1, 0},
+	{1, arcs_2_2, 0, 0, 0, 1},
 };
 static arc arcs_3_0[1] = {
 	{9, 1},
@@ -51,10 +95,25 @@ static arc arcs_3_1[1] = {
 static arc arcs_3_2[1] = {
 	{0, 2},
 };
+static const short accel_3_0[73] = {
+	9857, -1, -1, -1, 9857, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, 9857, -1, -1, -1,
+	-1, -1, -1, 9857, 9857, -1, -1, -1,
+	-1, -1, 9857, -1, 9857, -1, 9857, 9857,
+	9857,
+};
+static const short accel_3_1[1] = {
+	2,
+};
 static state states_3[3] = {
-	{1, arcs_3_0},
-	{1, arcs_3_1},
-	{1, arcs_3_2},
+	{1, arcs_3_0, 13, 86, accel_3_0, 0},
+	{1, arcs_3_1, 7, 8, accel_3_1, 0},
+	{1, arcs_3_2, 0, 0, 0, 1},
 };
 static arc arcs_4_0[1] = {
 	{12, 1},
@@ -74,13 +133,38 @@ static arc arcs_4_4[1] = {
 static arc arcs_4_5[1] = {
 	{0, 5},
 };
+static const short accel_4_0[1] = {
+	1,
+};
+static const short accel_4_1[1] = {
+	2,
+};
+static const short accel_4_2[1] = {
+	1411,
+};
+static const short accel_4_3[1] = {
+	4,
+};
+static const short accel_4_4[84] = {
+	6533, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, 6533, -1, -1, -1, 6533,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, 6533, -1, 6533, 6533,
+	-1, -1, -1, 6533, 6533, 6533, -1, 6533,
+	6533, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, 6533, 6533,
+	-1, -1, -1, -1, -1, 6533, -1, 6533,
+	-1, 6533, 6533, 6533,
+};
 static state states_4[6] = {
-	{1, arcs_4_0},
-	{1, arcs_4_1},
-	{1, arcs_4_2},
-	{1, arcs_4_3},
-	{1, arcs_4_4},
-	{1, arcs_4_5},
+	{1, arcs_4_0, 12, 13, accel_4_0, 0},
+	{1, arcs_4_1, 13, 14, accel_4_1, 0},
+	{1, arcs_4_2, 17, 18, accel_4_2, 0},
+	{1, arcs_4_3, 15, 16, accel_4_3, 0},
+	{1, arcs_4_4, 2, 86, accel_4_4, 0},
+	{1, arcs_4_5, 0, 0, 0, 1},
 };
 static arc arcs_5_0[1] = {
 	{17, 1},
@@ -95,11 +179,20 @@ static arc arcs_5_2[1] = {
 static arc arcs_5_3[1] = {
 	{0, 3},
 };
+static const short accel_5_0[1] = {
+	1,
+};
+static const short accel_5_1[7] = {
+	1666, -1, -1, -1, 1666, -1, 3,
+};
+static const short accel_5_2[1] = {
+	3,
+};
 static state states_5[4] = {
-	{1, arcs_5_0},
-	{2, arcs_5_1},
-	{1, arcs_5_2},
-	{1, arcs_5_3},
+	{1, arcs_5_0, 17, 18, accel_5_0, 0},
+	{2, arcs_5_1, 13, 20, accel_5_1, 0},
+	{1, arcs_5_2, 19, 20, accel_5_2, 0},
+	{1, arcs_5_3, 0, 0, 0, 1},
 };
 static arc arcs_6_0[1] = {
 	{20, 1},
@@ -108,9 +201,15 @@ static arc arcs_6_1[2] = {
 	{21, 0},
 	{0, 1},
 };
+static const short accel_6_0[5] = {
+	1921, -1, -1, -1, 1921,
+};
+static const short accel_6_1[1] = {
+	0,
+};
 static state states_6[2] = {
-	{1, arcs_6_0},
-	{2, arcs_6_1},
+	{1, arcs_6_0, 13, 18, accel_6_0, 0},
+	{2, arcs_6_1, 21, 22, accel_6_1, 1},
 };
 static arc arcs_7_0[2] = {
 	{13, 1},
@@ -125,11 +224,20 @@ static arc arcs_7_2[1] = {
 static arc arcs_7_3[1] = {
 	{19, 1},
 };
+static const short accel_7_0[5] = {
+	1, -1, -1, -1, 2,
+};
+static const short accel_7_2[5] = {
+	1667, -1, -1, -1, 1667,
+};
+static const short accel_7_3[1] = {
+	1,
+};
 static state states_7[4] = {
-	{2, arcs_7_0},
-	{1, arcs_7_1},
-	{1, arcs_7_2},
-	{1, arcs_7_3},
+	{2, arcs_7_0, 13, 18, accel_7_0, 0},
+	{1, arcs_7_1, 0, 0, 0, 1},
+	{1, arcs_7_2, 13, 18, accel_7_2, 0},
+	{1, arcs_7_3, 19, 20, accel_7_3, 0},
 };
 static arc arcs_8_0[2] = {
 	{3, 1},
@@ -138,9 +246,21 @@ static arc arcs_8_0[2] = {
 static arc arcs_8_1[1] = {
 	{0, 1},
 };
+static const short accel_8_0[77] = {
+	4993, 2433, -1, -1, -1, 2433, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, 2433, -1, 2433, 2433, -1, -1,
+	-1, 2433, 2433, 2433, -1, 2433, 2433, -1,
+	-1, -1, -1, -1, -1, 4993, -1, -1,
+	4993, 4993, -1, 4993, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, 2433, 2433, -1, -1,
+	-1, -1, -1, 2433, -1, 2433, -1, 2433,
+	2433, 2433, -1, -1, 4993,
+};
 static state states_8[2] = {
-	{2, arcs_8_0},
-	{1, arcs_8_1},
+	{2, arcs_8_0, 12, 89, accel_8_0, 0},
+	{1, arcs_8_1, 0, 0, 0, 1},
 };
 static arc arcs_9_0[6] = {
 	{22, 1},
@@ -153,9 +273,21 @@ static arc arcs_9_0[6] = {
 static arc arcs_9_1[1] = {
 	{0, 1},
 };
+static const short accel_9_0[73] = {
+	2689, -1, -1, -1, 2689, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, 2945, -1, 3201, 3457, -1, -1, -1,
+	3713, 3713, 3713, -1, 4737, 4737, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, 2689, 2689, -1, -1, -1,
+	-1, -1, 2689, -1, 2689, -1, 2689, 2689,
+	2689,
+};
 static state states_9[2] = {
-	{6, arcs_9_0},
-	{1, arcs_9_1},
+	{6, arcs_9_0, 13, 86, accel_9_0, 0},
+	{1, arcs_9_1, 0, 0, 0, 1},
 };
 static arc arcs_10_0[1] = {
 	{28, 1},
@@ -167,10 +299,28 @@ static arc arcs_10_1[2] = {
 static arc arcs_10_2[1] = {
 	{0, 2},
 };
+static const short accel_10_0[73] = {
+	9601, -1, -1, -1, 9601, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, 9601, 9601, -1, -1, -1,
+	-1, -1, 9601, -1, 9601, -1, 9601, 9601,
+	9601,
+};
+static const short accel_10_1[28] = {
+	2, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, 0,
+};
 static state states_10[3] = {
-	{1, arcs_10_0},
-	{2, arcs_10_1},
-	{1, arcs_10_2},
+	{1, arcs_10_0, 13, 86, accel_10_0, 0},
+	{2, arcs_10_1, 2, 30, accel_10_1, 0},
+	{1, arcs_10_2, 0, 0, 0, 1},
 };
 static arc arcs_11_0[1] = {
 	{30, 1},
@@ -186,11 +336,32 @@ static arc arcs_11_2[2] = {
 static arc arcs_11_3[1] = {
 	{0, 3},
 };
+static const short accel_11_0[1] = {
+	1,
+};
+static const short accel_11_1[84] = {
+	3, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, 6786, -1, -1, -1, 6786,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, 6786,
+	-1, -1, -1, -1, -1, -1, 6786, 6786,
+	-1, -1, -1, -1, -1, 6786, -1, 6786,
+	-1, 6786, 6786, 6786,
+};
+static const short accel_11_2[20] = {
+	3, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, 1,
+};
 static state states_11[4] = {
-	{1, arcs_11_0},
-	{2, arcs_11_1},
-	{2, arcs_11_2},
-	{1, arcs_11_3},
+	{1, arcs_11_0, 30, 31, accel_11_0, 0},
+	{2, arcs_11_1, 2, 86, accel_11_1, 0},
+	{2, arcs_11_2, 2, 22, accel_11_2, 0},
+	{1, arcs_11_3, 0, 0, 0, 1},
 };
 static arc arcs_12_0[1] = {
 	{32, 1},
@@ -204,11 +375,29 @@ static arc arcs_12_2[1] = {
 static arc arcs_12_3[1] = {
 	{0, 3},
 };
+static const short accel_12_0[1] = {
+	1,
+};
+static const short accel_12_1[73] = {
+	9602, -1, -1, -1, 9602, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, 9602, 9602, -1, -1, -1,
+	-1, -1, 9602, -1, 9602, -1, 9602, 9602,
+	9602,
+};
+static const short accel_12_2[1] = {
+	3,
+};
 static state states_12[4] = {
-	{1, arcs_12_0},
-	{1, arcs_12_1},
-	{1, arcs_12_2},
-	{1, arcs_12_3},
+	{1, arcs_12_0, 32, 33, accel_12_0, 0},
+	{1, arcs_12_1, 13, 86, accel_12_1, 0},
+	{1, arcs_12_2, 2, 3, accel_12_2, 0},
+	{1, arcs_12_3, 0, 0, 0, 1},
 };
 static arc arcs_13_0[1] = {
 	{33, 1},
@@ -219,10 +408,16 @@ static arc arcs_13_1[1] = {
 static arc arcs_13_2[1] = {
 	{0, 2},
 };
+static const short accel_13_0[1] = {
+	1,
+};
+static const short accel_13_1[1] = {
+	2,
+};
 static state states_13[3] = {
-	{1, arcs_13_0},
-	{1, arcs_13_1},
-	{1, arcs_13_2},
+	{1, arcs_13_0, 33, 34, accel_13_0, 0},
+	{1, arcs_13_1, 2, 3, accel_13_1, 0},
+	{1, arcs_13_2, 0, 0, 0, 1},
 };
 static arc arcs_14_0[3] = {
 	{34, 1},
@@ -232,9 +427,12 @@ static arc arcs_14_0[3] = {
 static arc arcs_14_1[1] = {
 	{0, 1},
 };
+static const short accel_14_0[3] = {
+	3969, 4225, 4481,
+};
 static state states_14[2] = {
-	{3, arcs_14_0},
-	{1, arcs_14_1},
+	{3, arcs_14_0, 37, 40, accel_14_0, 0},
+	{1, arcs_14_1, 0, 0, 0, 1},
 };
 static arc arcs_15_0[1] = {
 	{37, 1},
@@ -245,10 +443,16 @@ static arc arcs_15_1[1] = {
 static arc arcs_15_2[1] = {
 	{0, 2},
 };
+static const short accel_15_0[1] = {
+	1,
+};
+static const short accel_15_1[1] = {
+	2,
+};
 static state states_15[3] = {
-	{1, arcs_15_0},
-	{1, arcs_15_1},
-	{1, arcs_15_2},
+	{1, arcs_15_0, 37, 38, accel_15_0, 0},
+	{1, arcs_15_1, 2, 3, accel_15_1, 0},
+	{1, arcs_15_2, 0, 0, 0, 1},
 };
 static arc arcs_16_0[1] = {
 	{38, 1},
@@ -263,11 +467,30 @@ static arc arcs_16_2[1] = {
 static arc arcs_16_3[1] = {
 	{0, 3},
 };
+static const short accel_16_0[1] = {
+	1,
+};
+static const short accel_16_1[84] = {
+	3, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, 9858, -1, -1, -1, 9858,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, 9858,
+	-1, -1, -1, -1, -1, -1, 9858, 9858,
+	-1, -1, -1, -1, -1, 9858, -1, 9858,
+	-1, 9858, 9858, 9858,
+};
+static const short accel_16_2[1] = {
+	3,
+};
 static state states_16[4] = {
-	{1, arcs_16_0},
-	{2, arcs_16_1},
-	{1, arcs_16_2},
-	{1, arcs_16_3},
+	{1, arcs_16_0, 38, 39, accel_16_0, 0},
+	{2, arcs_16_1, 2, 86, accel_16_1, 0},
+	{1, arcs_16_2, 2, 3, accel_16_2, 0},
+	{1, arcs_16_3, 0, 0, 0, 1},
 };
 static arc arcs_17_0[1] = {
 	{39, 1},
@@ -288,13 +511,48 @@ static arc arcs_17_4[1] = {
 static arc arcs_17_5[1] = {
 	{2, 4},
 };
+static const short accel_17_0[1] = {
+	1,
+};
+static const short accel_17_1[73] = {
+	8066, -1, -1, -1, 8066, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, 8066, 8066, -1, -1, -1,
+	-1, -1, 8066, -1, 8066, -1, 8066, 8066,
+	8066,
+};
+static const short accel_17_2[20] = {
+	4, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, 3,
+};
+static const short accel_17_3[73] = {
+	8069, -1, -1, -1, 8069, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, 8069, 8069, -1, -1, -1,
+	-1, -1, 8069, -1, 8069, -1, 8069, 8069,
+	8069,
+};
+static const short accel_17_5[1] = {
+	4,
+};
 static state states_17[6] = {
-	{1, arcs_17_0},
-	{1, arcs_17_1},
-	{2, arcs_17_2},
-	{1, arcs_17_3},
-	{1, arcs_17_4},
-	{1, arcs_17_5},
+	{1, arcs_17_0, 39, 40, accel_17_0, 0},
+	{1, arcs_17_1, 13, 86, accel_17_1, 0},
+	{2, arcs_17_2, 2, 22, accel_17_2, 0},
+	{1, arcs_17_3, 13, 86, accel_17_3, 0},
+	{1, arcs_17_4, 0, 0, 0, 1},
+	{1, arcs_17_5, 2, 3, accel_17_5, 0},
 };
 static arc arcs_18_0[2] = {
 	{41, 1},
@@ -318,29 +576,46 @@ static arc arcs_18_5[1] = {
 };
 static arc arcs_18_6[2] = {
 	{43, 7},
-	{13, 8},
+	{13, 3},
 };
 static arc arcs_18_7[1] = {
 	{2, 5},
 };
-static arc arcs_18_8[2] = {
-	{21, 9},
-	{2, 5},
+static const short accel_18_0[2] = {
+	1, 2,
+};
+static const short accel_18_1[1] = {
+	3,
+};
+static const short accel_18_2[1] = {
+	4,
+};
+static const short accel_18_3[20] = {
+	5, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, 1,
 };
-static arc arcs_18_9[1] = {
-	{13, 8},
-};
-static state states_18[10] = {
-	{2, arcs_18_0},
-	{1, arcs_18_1},
-	{1, arcs_18_2},
-	{2, arcs_18_3},
-	{1, arcs_18_4},
-	{1, arcs_18_5},
-	{2, arcs_18_6},
-	{1, arcs_18_7},
-	{2, arcs_18_8},
-	{1, arcs_18_9},
+static const short accel_18_4[1] = {
+	6,
+};
+static const short accel_18_6[31] = {
+	3, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, 7,
+};
+static const short accel_18_7[1] = {
+	5,
+};
+static state states_18[8] = {
+	{2, arcs_18_0, 41, 43, accel_18_0, 0},
+	{1, arcs_18_1, 13, 14, accel_18_1, 0},
+	{1, arcs_18_2, 13, 14, accel_18_2, 0},
+	{2, arcs_18_3, 2, 22, accel_18_3, 0},
+	{1, arcs_18_4, 41, 42, accel_18_4, 0},
+	{1, arcs_18_5, 0, 0, 0, 1},
+	{2, arcs_18_6, 13, 44, accel_18_6, 0},
+	{1, arcs_18_7, 2, 3, accel_18_7, 0},
 };
 static arc arcs_19_0[6] = {
 	{44, 1},
@@ -353,9 +628,21 @@ static arc arcs_19_0[6] = {
 static arc arcs_19_1[1] = {
 	{0, 1},
 };
+static const short accel_19_0[77] = {
+	1153, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, 5249, -1, -1,
+	5505, 5761, -1, 6017, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, 10113,
+};
 static state states_19[2] = {
-	{6, arcs_19_0},
-	{1, arcs_19_1},
+	{6, arcs_19_0, 12, 89, accel_19_0, 0},
+	{1, arcs_19_1, 0, 0, 0, 1},
 };
 static arc arcs_20_0[1] = {
 	{49, 1},
@@ -383,15 +670,65 @@ static arc arcs_20_6[1] = {
 static arc arcs_20_7[1] = {
 	{0, 7},
 };
+static const short accel_20_0[1] = {
+	1,
+};
+static const short accel_20_1[73] = {
+	6786, -1, -1, -1, 6786, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, 6786, -1, -1, -1,
+	-1, -1, -1, 6786, 6786, -1, -1, -1,
+	-1, -1, 6786, -1, 6786, -1, 6786, 6786,
+	6786,
+};
+static const short accel_20_2[1] = {
+	3,
+};
+static const short accel_20_3[84] = {
+	6532, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, 6532, -1, -1, -1, 6532,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, 6532, -1, 6532, 6532,
+	-1, -1, -1, 6532, 6532, 6532, -1, 6532,
+	6532, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, 6532, 6532,
+	-1, -1, -1, -1, -1, 6532, -1, 6532,
+	-1, 6532, 6532, 6532,
+};
+static const short accel_20_4[2] = {
+	1, 5,
+};
+static const short accel_20_5[1] = {
+	6,
+};
+static const short accel_20_6[84] = {
+	6535, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, 6535, -1, -1, -1, 6535,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, 6535, -1, 6535, 6535,
+	-1, -1, -1, 6535, 6535, 6535, -1, 6535,
+	6535, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, 6535, 6535,
+	-1, -1, -1, -1, -1, 6535, -1, 6535,
+	-1, 6535, 6535, 6535,
+};
 static state states_20[8] = {
-	{1, arcs_20_0},
-	{1, arcs_20_1},
-	{1, arcs_20_2},
-	{1, arcs_20_3},
-	{3, arcs_20_4},
-	{1, arcs_20_5},
-	{1, arcs_20_6},
-	{1, arcs_20_7},
+	{1, arcs_20_0, 49, 50, accel_20_0, 0},
+	{1, arcs_20_1, 13, 86, accel_20_1, 0},
+	{1, arcs_20_2, 15, 16, accel_20_2, 0},
+	{1, arcs_20_3, 2, 86, accel_20_3, 0},
+	{3, arcs_20_4, 50, 52, accel_20_4, 1},
+	{1, arcs_20_5, 15, 16, accel_20_5, 0},
+	{1, arcs_20_6, 2, 86, accel_20_6, 0},
+	{1, arcs_20_7, 0, 0, 0, 1},
 };
 static arc arcs_21_0[1] = {
 	{52, 1},
@@ -418,15 +755,65 @@ static arc arcs_21_6[1] = {
 static arc arcs_21_7[1] = {
 	{0, 7},
 };
+static const short accel_21_0[1] = {
+	1,
+};
+static const short accel_21_1[73] = {
+	6786, -1, -1, -1, 6786, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, 6786, -1, -1, -1,
+	-1, -1, -1, 6786, 6786, -1, -1, -1,
+	-1, -1, 6786, -1, 6786, -1, 6786, 6786,
+	6786,
+};
+static const short accel_21_2[1] = {
+	3,
+};
+static const short accel_21_3[84] = {
+	6532, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, 6532, -1, -1, -1, 6532,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, 6532, -1, 6532, 6532,
+	-1, -1, -1, 6532, 6532, 6532, -1, 6532,
+	6532, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, 6532, 6532,
+	-1, -1, -1, -1, -1, 6532, -1, 6532,
+	-1, 6532, 6532, 6532,
+};
+static const short accel_21_4[1] = {
+	5,
+};
+static const short accel_21_5[1] = {
+	6,
+};
+static const short accel_21_6[84] = {
+	6535, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, 6535, -1, -1, -1, 6535,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, 6535, -1, 6535, 6535,
+	-1, -1, -1, 6535, 6535, 6535, -1, 6535,
+	6535, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, 6535, 6535,
+	-1, -1, -1, -1, -1, 6535, -1, 6535,
+	-1, 6535, 6535, 6535,
+};
 static state states_21[8] = {
-	{1, arcs_21_0},
-	{1, arcs_21_1},
-	{1, arcs_21_2},
-	{1, arcs_21_3},
-	{2, arcs_21_4},
-	{1, arcs_21_5},
-	{1, arcs_21_6},
-	{1, arcs_21_7},
+	{1, arcs_21_0, 52, 53, accel_21_0, 0},
+	{1, arcs_21_1, 13, 86, accel_21_1, 0},
+	{1, arcs_21_2, 15, 16, accel_21_2, 0},
+	{1, arcs_21_3, 2, 86, accel_21_3, 0},
+	{2, arcs_21_4, 51, 52, accel_21_4, 1},
+	{1, arcs_21_5, 15, 16, accel_21_5, 0},
+	{1, arcs_21_6, 2, 86, accel_21_6, 0},
+	{1, arcs_21_7, 0, 0, 0, 1},
 };
 static arc arcs_22_0[1] = {
 	{53, 1},
@@ -459,17 +846,82 @@ static arc arcs_22_8[1] = {
 static arc arcs_22_9[1] = {
 	{0, 9},
 };
+static const short accel_22_0[1] = {
+	1,
+};
+static const short accel_22_1[73] = {
+	9602, -1, -1, -1, 9602, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, 9602, 9602, -1, -1, -1,
+	-1, -1, 9602, -1, 9602, -1, 9602, 9602,
+	9602,
+};
+static const short accel_22_2[1] = {
+	3,
+};
+static const short accel_22_3[73] = {
+	9604, -1, -1, -1, 9604, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, 9604, 9604, -1, -1, -1,
+	-1, -1, 9604, -1, 9604, -1, 9604, 9604,
+	9604,
+};
+static const short accel_22_4[1] = {
+	5,
+};
+static const short accel_22_5[84] = {
+	6534, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, 6534, -1, -1, -1, 6534,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, 6534, -1, 6534, 6534,
+	-1, -1, -1, 6534, 6534, 6534, -1, 6534,
+	6534, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, 6534, 6534,
+	-1, -1, -1, -1, -1, 6534, -1, 6534,
+	-1, 6534, 6534, 6534,
+};
+static const short accel_22_6[1] = {
+	7,
+};
+static const short accel_22_7[1] = {
+	8,
+};
+static const short accel_22_8[84] = {
+	6537, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, 6537, -1, -1, -1, 6537,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, 6537, -1, 6537, 6537,
+	-1, -1, -1, 6537, 6537, 6537, -1, 6537,
+	6537, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, 6537, 6537,
+	-1, -1, -1, -1, -1, 6537, -1, 6537,
+	-1, 6537, 6537, 6537,
+};
 static state states_22[10] = {
-	{1, arcs_22_0},
-	{1, arcs_22_1},
-	{1, arcs_22_2},
-	{1, arcs_22_3},
-	{1, arcs_22_4},
-	{1, arcs_22_5},
-	{2, arcs_22_6},
-	{1, arcs_22_7},
-	{1, arcs_22_8},
-	{1, arcs_22_9},
+	{1, arcs_22_0, 53, 54, accel_22_0, 0},
+	{1, arcs_22_1, 13, 86, accel_22_1, 0},
+	{1, arcs_22_2, 54, 55, accel_22_2, 0},
+	{1, arcs_22_3, 13, 86, accel_22_3, 0},
+	{1, arcs_22_4, 15, 16, accel_22_4, 0},
+	{1, arcs_22_5, 2, 86, accel_22_5, 0},
+	{2, arcs_22_6, 51, 52, accel_22_6, 1},
+	{1, arcs_22_7, 15, 16, accel_22_7, 0},
+	{1, arcs_22_8, 2, 86, accel_22_8, 0},
+	{1, arcs_22_9, 0, 0, 0, 1},
 };
 static arc arcs_23_0[1] = {
 	{55, 1},
@@ -494,14 +946,52 @@ static arc arcs_23_5[1] = {
 static arc arcs_23_6[1] = {
 	{0, 6},
 };
+static const short accel_23_0[1] = {
+	1,
+};
+static const short accel_23_1[1] = {
+	2,
+};
+static const short accel_23_2[84] = {
+	6531, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, 6531, -1, -1, -1, 6531,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, 6531, -1, 6531, 6531,
+	-1, -1, -1, 6531, 6531, 6531, -1, 6531,
+	6531, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, 6531, 6531,
+	-1, -1, -1, -1, -1, 6531, -1, 6531,
+	-1, 6531, 6531, 6531,
+};
+static const short accel_23_3[2] = {
+	4, 6273,
+};
+static const short accel_23_4[1] = {
+	5,
+};
+static const short accel_23_5[84] = {
+	6534, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, 6534, -1, -1, -1, 6534,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, 6534, -1, 6534, 6534,
+	-1, -1, -1, 6534, 6534, 6534, -1, 6534,
+	6534, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, 6534, 6534,
+	-1, -1, -1, -1, -1, 6534, -1, 6534,
+	-1, 6534, 6534, 6534,
+};
 static state states_23[7] = {
-	{1, arcs_23_0},
-	{1, arcs_23_1},
-	{1, arcs_23_2},
-	{3, arcs_23_3},
-	{1, arcs_23_4},
-	{1, arcs_23_5},
-	{1, arcs_23_6},
+	{1, arcs_23_0, 55, 56, accel_23_0, 0},
+	{1, arcs_23_1, 15, 16, accel_23_1, 0},
+	{1, arcs_23_2, 2, 86, accel_23_2, 0},
+	{3, arcs_23_3, 57, 59, accel_23_3, 1},
+	{1, arcs_23_4, 15, 16, accel_23_4, 0},
+	{1, arcs_23_5, 2, 86, accel_23_5, 0},
+	{1, arcs_23_6, 0, 0, 0, 1},
 };
 static arc arcs_24_0[1] = {
 	{58, 1},
@@ -520,12 +1010,42 @@ static arc arcs_24_3[1] = {
 static arc arcs_24_4[1] = {
 	{0, 4},
 };
+static const short accel_24_0[1] = {
+	1,
+};
+static const short accel_24_1[73] = {
+	8066, -1, -1, -1, 8066, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, 8066, 8066, -1, -1, -1,
+	-1, -1, 8066, -1, 8066, -1, 8066, 8066,
+	8066,
+};
+static const short accel_24_2[1] = {
+	3,
+};
+static const short accel_24_3[73] = {
+	8068, -1, -1, -1, 8068, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, 8068, 8068, -1, -1, -1,
+	-1, -1, 8068, -1, 8068, -1, 8068, 8068,
+	8068,
+};
 static state states_24[5] = {
-	{1, arcs_24_0},
-	{2, arcs_24_1},
-	{2, arcs_24_2},
-	{1, arcs_24_3},
-	{1, arcs_24_4},
+	{1, arcs_24_0, 58, 59, accel_24_0, 0},
+	{2, arcs_24_1, 13, 86, accel_24_1, 1},
+	{2, arcs_24_2, 21, 22, accel_24_2, 1},
+	{1, arcs_24_3, 13, 86, accel_24_3, 0},
+	{1, arcs_24_4, 0, 0, 0, 1},
 };
 static arc arcs_25_0[2] = {
 	{3, 1},
@@ -546,12 +1066,54 @@ static arc arcs_25_4[3] = {
 	{2, 4},
 	{60, 1},
 };
+static const short accel_25_0[84] = {
+	2, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, 2433, -1, -1, -1, 2433,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, 2433, -1, 2433, 2433,
+	-1, -1, -1, 2433, 2433, 2433, -1, 2433,
+	2433, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, 2433, 2433,
+	-1, -1, -1, -1, -1, 2433, -1, 2433,
+	-1, 2433, 2433, 2433,
+};
+static const short accel_25_2[1] = {
+	3,
+};
+static const short accel_25_3[87] = {
+	3, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, 2180, 2180, -1, -1, -1, 2180,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, 2180, -1, 2180, 2180,
+	-1, -1, -1, 2180, 2180, 2180, -1, 2180,
+	2180, -1, -1, -1, -1, -1, -1, 2180,
+	-1, -1, 2180, 2180, -1, 2180, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, 2180, 2180,
+	-1, -1, -1, -1, -1, 2180, -1, 2180,
+	-1, 2180, 2180, 2180, -1, -1, 2180,
+};
+static const short accel_25_4[87] = {
+	4, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, 2180, 2180, -1, -1, -1, 2180,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, 2180, -1, 2180, 2180,
+	-1, -1, -1, 2180, 2180, 2180, -1, 2180,
+	2180, -1, -1, -1, -1, -1, -1, 2180,
+	-1, -1, 2180, 2180, -1, 2180, -1, -1,
+	-1, -1, 1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, 2180, 2180,
+	-1, -1, -1, -1, -1, 2180, -1, 2180,
+	-1, 2180, 2180, 2180, -1, -1, 2180,
+};
 static state states_25[5] = {
-	{2, arcs_25_0},
-	{1, arcs_25_1},
-	{1, arcs_25_2},
-	{2, arcs_25_3},
-	{3, arcs_25_4},
+	{2, arcs_25_0, 2, 86, accel_25_0, 0},
+	{1, arcs_25_1, 0, 0, 0, 1},
+	{1, arcs_25_2, 59, 60, accel_25_2, 0},
+	{2, arcs_25_3, 2, 89, accel_25_3, 0},
+	{3, arcs_25_4, 2, 89, accel_25_4, 0},
 };
 static arc arcs_26_0[1] = {
 	{61, 1},
@@ -560,9 +1122,24 @@ static arc arcs_26_1[2] = {
 	{62, 0},
 	{0, 1},
 };
+static const short accel_26_0[73] = {
+	7041, -1, -1, -1, 7041, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, 7041, -1, -1, -1,
+	-1, -1, -1, 7041, 7041, -1, -1, -1,
+	-1, -1, 7041, -1, 7041, -1, 7041, 7041,
+	7041,
+};
+static const short accel_26_1[1] = {
+	0,
+};
 static state states_26[2] = {
-	{1, arcs_26_0},
-	{2, arcs_26_1},
+	{1, arcs_26_0, 13, 86, accel_26_0, 0},
+	{2, arcs_26_1, 62, 63, accel_26_1, 1},
 };
 static arc arcs_27_0[1] = {
 	{63, 1},
@@ -571,9 +1148,24 @@ static arc arcs_27_1[2] = {
 	{64, 0},
 	{0, 1},
 };
+static const short accel_27_0[73] = {
+	7297, -1, -1, -1, 7297, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, 7297, -1, -1, -1,
+	-1, -1, -1, 7297, 7297, -1, -1, -1,
+	-1, -1, 7297, -1, 7297, -1, 7297, 7297,
+	7297,
+};
+static const short accel_27_1[1] = {
+	0,
+};
 static state states_27[2] = {
-	{1, arcs_27_0},
-	{2, arcs_27_1},
+	{1, arcs_27_0, 13, 86, accel_27_0, 0},
+	{2, arcs_27_1, 64, 65, accel_27_1, 1},
 };
 static arc arcs_28_0[2] = {
 	{65, 1},
@@ -585,10 +1177,34 @@ static arc arcs_28_1[1] = {
 static arc arcs_28_2[1] = {
 	{0, 2},
 };
+static const short accel_28_0[73] = {
+	7554, -1, -1, -1, 7554, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, 1, -1, -1, -1,
+	-1, -1, -1, 7554, 7554, -1, -1, -1,
+	-1, -1, 7554, -1, 7554, -1, 7554, 7554,
+	7554,
+};
+static const short accel_28_1[73] = {
+	7298, -1, -1, -1, 7298, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, 7298, -1, -1, -1,
+	-1, -1, -1, 7298, 7298, -1, -1, -1,
+	-1, -1, 7298, -1, 7298, -1, 7298, 7298,
+	7298,
+};
 static state states_28[3] = {
-	{2, arcs_28_0},
-	{1, arcs_28_1},
-	{1, arcs_28_2},
+	{2, arcs_28_0, 13, 86, accel_28_0, 0},
+	{1, arcs_28_1, 13, 86, accel_28_1, 0},
+	{1, arcs_28_2, 0, 0, 0, 1},
 };
 static arc arcs_29_0[1] = {
 	{40, 1},
@@ -597,9 +1213,29 @@ static arc arcs_29_1[2] = {
 	{67, 0},
 	{0, 1},
 };
+static const short accel_29_0[73] = {
+	8065, -1, -1, -1, 8065, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, 8065, 8065, -1, -1, -1,
+	-1, -1, 8065, -1, 8065, -1, 8065, 8065,
+	8065,
+};
+static const short accel_29_1[42] = {
+	7808, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, 7808, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, 7808, -1, -1, 7808,
+	7808, 7808,
+};
 static state states_29[2] = {
-	{1, arcs_29_0},
-	{2, arcs_29_1},
+	{1, arcs_29_0, 13, 86, accel_29_0, 0},
+	{2, arcs_29_1, 29, 71, accel_29_1, 1},
 };
 static arc arcs_30_0[6] = {
 	{68, 1},
@@ -628,13 +1264,38 @@ static arc arcs_30_5[2] = {
 	{65, 3},
 	{0, 5},
 };
+static const short accel_30_0[42] = {
+	3, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, 3, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, 4, -1, -1, 1,
+	2, 5,
+};
+static const short accel_30_1[41] = {
+	3, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	3,
+};
+static const short accel_30_2[1] = {
+	3,
+};
+static const short accel_30_4[1] = {
+	3,
+};
+static const short accel_30_5[1] = {
+	3,
+};
 static state states_30[6] = {
-	{6, arcs_30_0},
-	{3, arcs_30_1},
-	{2, arcs_30_2},
-	{1, arcs_30_3},
-	{1, arcs_30_4},
-	{2, arcs_30_5},
+	{6, arcs_30_0, 29, 71, accel_30_0, 0},
+	{3, arcs_30_1, 29, 70, accel_30_1, 1},
+	{2, arcs_30_2, 29, 30, accel_30_2, 1},
+	{1, arcs_30_3, 0, 0, 0, 1},
+	{1, arcs_30_4, 54, 55, accel_30_4, 0},
+	{2, arcs_30_5, 65, 66, accel_30_5, 1},
 };
 static arc arcs_31_0[1] = {
 	{71, 1},
@@ -644,9 +1305,24 @@ static arc arcs_31_1[3] = {
 	{73, 0},
 	{0, 1},
 };
+static const short accel_31_0[73] = {
+	8321, -1, -1, -1, 8321, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, 8321, 8321, -1, -1, -1,
+	-1, -1, 8321, -1, 8321, -1, 8321, 8321,
+	8321,
+};
+static const short accel_31_1[2] = {
+	0, 0,
+};
 static state states_31[2] = {
-	{1, arcs_31_0},
-	{3, arcs_31_1},
+	{1, arcs_31_0, 13, 86, accel_31_0, 0},
+	{3, arcs_31_1, 72, 74, accel_31_1, 1},
 };
 static arc arcs_32_0[1] = {
 	{74, 1},
@@ -657,9 +1333,28 @@ static arc arcs_32_1[4] = {
 	{76, 0},
 	{0, 1},
 };
+static const short accel_32_0[73] = {
+	8577, -1, -1, -1, 8577, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, 8577, 8577, -1, -1, -1,
+	-1, -1, 8577, -1, 8577, -1, 8577, 8577,
+	8577,
+};
+static const short accel_32_1[34] = {
+	0, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	0, 0,
+};
 static state states_32[2] = {
-	{1, arcs_32_0},
-	{4, arcs_32_1},
+	{1, arcs_32_0, 13, 86, accel_32_0, 0},
+	{4, arcs_32_1, 43, 77, accel_32_1, 1},
 };
 static arc arcs_33_0[3] = {
 	{72, 1},
@@ -676,11 +1371,46 @@ static arc arcs_33_2[2] = {
 static arc arcs_33_3[1] = {
 	{0, 3},
 };
+static const short accel_33_0[73] = {
+	8834, -1, -1, -1, 8834, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, 1, 1, -1, -1, -1,
+	-1, -1, 8834, -1, 8834, -1, 8834, 8834,
+	8834,
+};
+static const short accel_33_1[73] = {
+	8579, -1, -1, -1, 8579, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, 8579, 8579, -1, -1, -1,
+	-1, -1, 8579, -1, 8579, -1, 8579, 8579,
+	8579,
+};
+static const short accel_33_2[71] = {
+	9090, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, 9090, -1,
+	-1, -1, -1, -1, -1, -1, 9090,
+};
 static state states_33[4] = {
-	{3, arcs_33_0},
-	{1, arcs_33_1},
-	{2, arcs_33_2},
-	{1, arcs_33_3},
+	{3, arcs_33_0, 13, 86, accel_33_0, 0},
+	{1, arcs_33_1, 13, 86, accel_33_1, 0},
+	{2, arcs_33_2, 17, 88, accel_33_2, 1},
+	{1, arcs_33_3, 0, 0, 0, 1},
 };
 static arc arcs_34_0[7] = {
 	{17, 1},
@@ -717,16 +1447,76 @@ static arc arcs_34_7[1] = {
 static arc arcs_34_8[1] = {
 	{83, 5},
 };
+static const short accel_34_0[73] = {
+	5, -1, -1, -1, 1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, 2, -1, 3, -1, 4, 5,
+	5,
+};
+static const short accel_34_1[73] = {
+	9862, -1, -1, -1, 9862, -1, 5, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, 9862, -1, -1, -1,
+	-1, -1, -1, 9862, 9862, -1, -1, -1,
+	-1, -1, 9862, -1, 9862, -1, 9862, 9862,
+	9862,
+};
+static const short accel_34_2[73] = {
+	9863, -1, -1, -1, 9863, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, 9863, -1, -1, -1,
+	-1, -1, -1, 9863, 9863, -1, -1, -1,
+	-1, -1, 9863, 5, 9863, -1, 9863, 9863,
+	9863,
+};
+static const short accel_34_3[1] = {
+	5,
+};
+static const short accel_34_4[73] = {
+	9864, -1, -1, -1, 9864, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, 9864, -1, -1, -1,
+	-1, -1, -1, 9864, 9864, -1, -1, -1,
+	-1, -1, 9864, -1, 9864, -1, 9864, 9864,
+	9864,
+};
+static const short accel_34_6[1] = {
+	5,
+};
+static const short accel_34_7[1] = {
+	5,
+};
+static const short accel_34_8[1] = {
+	5,
+};
 static state states_34[9] = {
-	{7, arcs_34_0},
-	{2, arcs_34_1},
-	{2, arcs_34_2},
-	{1, arcs_34_3},
-	{1, arcs_34_4},
-	{1, arcs_34_5},
-	{1, arcs_34_6},
-	{1, arcs_34_7},
-	{1, arcs_34_8},
+	{7, arcs_34_0, 13, 86, accel_34_0, 0},
+	{2, arcs_34_1, 13, 86, accel_34_1, 0},
+	{2, arcs_34_2, 13, 86, accel_34_2, 0},
+	{1, arcs_34_3, 82, 83, accel_34_3, 0},
+	{1, arcs_34_4, 13, 86, accel_34_4, 0},
+	{1, arcs_34_5, 0, 0, 0, 1},
+	{1, arcs_34_6, 19, 20, accel_34_6, 0},
+	{1, arcs_34_7, 80, 81, accel_34_7, 0},
+	{1, arcs_34_8, 83, 84, accel_34_8, 0},
 };
 static arc arcs_35_0[3] = {
 	{17, 1},
@@ -752,14 +1542,58 @@ static arc arcs_35_5[1] = {
 static arc arcs_35_6[1] = {
 	{80, 5},
 };
+static const short accel_35_0[71] = {
+	1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, 2, -1,
+	-1, -1, -1, -1, -1, -1, 3,
+};
+static const short accel_35_1[73] = {
+	9860, -1, -1, -1, 9860, -1, 5, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, 9860, -1, -1, -1,
+	-1, -1, -1, 9860, 9860, -1, -1, -1,
+	-1, -1, 9860, -1, 9860, -1, 9860, 9860,
+	9860,
+};
+static const short accel_35_2[73] = {
+	9350, -1, 9350, -1, 9350, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, 9350, 9350, -1, -1, -1,
+	-1, -1, 9350, -1, 9350, -1, 9350, 9350,
+	9350,
+};
+static const short accel_35_3[1] = {
+	5,
+};
+static const short accel_35_4[1] = {
+	5,
+};
+static const short accel_35_6[1] = {
+	5,
+};
 static state states_35[7] = {
-	{3, arcs_35_0},
-	{2, arcs_35_1},
-	{1, arcs_35_2},
-	{1, arcs_35_3},
-	{1, arcs_35_4},
-	{1, arcs_35_5},
-	{1, arcs_35_6},
+	{3, arcs_35_0, 17, 88, accel_35_0, 0},
+	{2, arcs_35_1, 13, 86, accel_35_1, 0},
+	{1, arcs_35_2, 13, 86, accel_35_2, 0},
+	{1, arcs_35_3, 13, 14, accel_35_3, 0},
+	{1, arcs_35_4, 19, 20, accel_35_4, 0},
+	{1, arcs_35_5, 0, 0, 0, 1},
+	{1, arcs_35_6, 80, 81, accel_35_6, 0},
 };
 static arc arcs_36_0[2] = {
 	{40, 1},
@@ -776,11 +1610,38 @@ static arc arcs_36_2[2] = {
 static arc arcs_36_3[1] = {
 	{0, 3},
 };
+static const short accel_36_0[73] = {
+	8065, -1, 2, -1, 8065, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, 8065, 8065, -1, -1, -1,
+	-1, -1, 8065, -1, 8065, -1, 8065, 8065,
+	8065,
+};
+static const short accel_36_1[1] = {
+	2,
+};
+static const short accel_36_2[73] = {
+	8067, -1, -1, -1, 8067, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, 8067, 8067, -1, -1, -1,
+	-1, -1, 8067, -1, 8067, -1, 8067, 8067,
+	8067,
+};
 static state states_36[4] = {
-	{2, arcs_36_0},
-	{2, arcs_36_1},
-	{2, arcs_36_2},
-	{1, arcs_36_3},
+	{2, arcs_36_0, 13, 86, accel_36_0, 0},
+	{2, arcs_36_1, 15, 16, accel_36_1, 1},
+	{2, arcs_36_2, 13, 86, accel_36_2, 1},
+	{1, arcs_36_3, 0, 0, 0, 1},
 };
 static arc arcs_37_0[1] = {
 	{40, 1},
@@ -793,10 +1654,37 @@ static arc arcs_37_2[2] = {
 	{40, 1},
 	{0, 2},
 };
+static const short accel_37_0[73] = {
+	8065, -1, -1, -1, 8065, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, 8065, 8065, -1, -1, -1,
+	-1, -1, 8065, -1, 8065, -1, 8065, 8065,
+	8065,
+};
+static const short accel_37_1[1] = {
+	2,
+};
+static const short accel_37_2[73] = {
+	8065, -1, -1, -1, 8065, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, 8065, 8065, -1, -1, -1,
+	-1, -1, 8065, -1, 8065, -1, 8065, 8065,
+	8065,
+};
 static state states_37[3] = {
-	{1, arcs_37_0},
-	{2, arcs_37_1},
-	{2, arcs_37_2},
+	{1, arcs_37_0, 13, 86, accel_37_0, 0},
+	{2, arcs_37_1, 21, 22, accel_37_1, 1},
+	{2, arcs_37_2, 13, 86, accel_37_2, 1},
 };
 static arc arcs_38_0[1] = {
 	{31, 1},
@@ -809,10 +1697,37 @@ static arc arcs_38_2[2] = {
 	{31, 1},
 	{0, 2},
 };
+static const short accel_38_0[73] = {
+	6785, -1, -1, -1, 6785, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, 6785, -1, -1, -1,
+	-1, -1, -1, 6785, 6785, -1, -1, -1,
+	-1, -1, 6785, -1, 6785, -1, 6785, 6785,
+	6785,
+};
+static const short accel_38_1[1] = {
+	2,
+};
+static const short accel_38_2[73] = {
+	6785, -1, -1, -1, 6785, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, 6785, -1, -1, -1,
+	-1, -1, -1, 6785, 6785, -1, -1, -1,
+	-1, -1, 6785, -1, 6785, -1, 6785, 6785,
+	6785,
+};
 static state states_38[3] = {
-	{1, arcs_38_0},
-	{2, arcs_38_1},
-	{2, arcs_38_2},
+	{1, arcs_38_0, 13, 86, accel_38_0, 0},
+	{2, arcs_38_1, 21, 22, accel_38_1, 1},
+	{2, arcs_38_2, 13, 86, accel_38_2, 1},
 };
 static arc arcs_39_0[1] = {
 	{88, 1},
@@ -839,15 +1754,56 @@ static arc arcs_39_6[1] = {
 static arc arcs_39_7[1] = {
 	{0, 7},
 };
+static const short accel_39_0[1] = {
+	1,
+};
+static const short accel_39_1[1] = {
+	2,
+};
+static const short accel_39_2[1] = {
+	1411,
+};
+static const short accel_39_3[15] = {
+	5, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, 4,
+};
+static const short accel_39_4[73] = {
+	10374, -1, -1, -1, 10374, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, 10374, -1, 10374, -1, 10374, 10374,
+	10374,
+};
+static const short accel_39_5[84] = {
+	6535, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, 6535, -1, -1, -1, 6535,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, 6535, -1, 6535, 6535,
+	-1, -1, -1, 6535, 6535, 6535, -1, 6535,
+	6535, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, 6535, 6535,
+	-1, -1, -1, -1, -1, 6535, -1, 6535,
+	-1, 6535, 6535, 6535,
+};
+static const short accel_39_6[1] = {
+	5,
+};
 static state states_39[8] = {
-	{1, arcs_39_0},
-	{1, arcs_39_1},
-	{1, arcs_39_2},
-	{2, arcs_39_3},
-	{1, arcs_39_4},
-	{1, arcs_39_5},
-	{1, arcs_39_6},
-	{1, arcs_39_7},
+	{1, arcs_39_0, 88, 89, accel_39_0, 0},
+	{1, arcs_39_1, 13, 14, accel_39_1, 0},
+	{1, arcs_39_2, 17, 18, accel_39_2, 0},
+	{2, arcs_39_3, 15, 30, accel_39_3, 0},
+	{1, arcs_39_4, 13, 86, accel_39_4, 0},
+	{1, arcs_39_5, 2, 86, accel_39_5, 0},
+	{1, arcs_39_6, 15, 16, accel_39_6, 0},
+	{1, arcs_39_7, 0, 0, 0, 1},
 };
 static arc arcs_40_0[1] = {
 	{77, 1},
@@ -859,10 +1815,28 @@ static arc arcs_40_2[2] = {
 	{21, 0},
 	{0, 2},
 };
+static const short accel_40_0[73] = {
+	8833, -1, -1, -1, 8833, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, 8833, -1, 8833, -1, 8833, 8833,
+	8833,
+};
+static const short accel_40_1[1] = {
+	10626,
+};
+static const short accel_40_2[1] = {
+	0,
+};
 static state states_40[3] = {
-	{1, arcs_40_0},
-	{1, arcs_40_1},
-	{2, arcs_40_2},
+	{1, arcs_40_0, 13, 86, accel_40_0, 0},
+	{1, arcs_40_1, 17, 18, accel_40_1, 0},
+	{2, arcs_40_2, 21, 22, accel_40_2, 1},
 };
 static arc arcs_41_0[1] = {
 	{17, 1},
@@ -877,11 +1851,29 @@ static arc arcs_41_2[1] = {
 static arc arcs_41_3[1] = {
 	{0, 3},
 };
+static const short accel_41_0[1] = {
+	1,
+};
+static const short accel_41_1[73] = {
+	9858, -1, -1, -1, 9858, -1, 3, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, -1, -1, -1, -1,
+	-1, -1, -1, -1, 9858, -1, -1, -1,
+	-1, -1, -1, 9858, 9858, -1, -1, -1,
+	-1, -1, 9858, -1, 9858, -1, 9858, 9858,
+	9858,
+};
+static const short accel_41_2[1] = {
+	3,
+};
 static state states_41[4] = {
-	{1, arcs_41_0},
-	{2, arcs_41_1},
-	{1, arcs_41_2},
-	{1, arcs_41_3},
+	{1, arcs_41_0, 17, 18, accel_41_0, 0},
+	{2, arcs_41_1, 13, 86, accel_41_1, 0},
+	{1, arcs_41_2, 19, 20, accel_41_2, 0},
+	{1, arcs_41_3, 0, 0, 0, 1},
 };
 static dfa dfas[42] = {
 	{256, "single_input", 0, 3, states_0,
@@ -920,7 +1912,7 @@ static dfa dfas[42] = {
 	 "\000\000\000\000\100\000\000\000\000\000\000\000"},
 	{273, "raise_stmt", 0, 6, states_17,
 	 "\000\000\000\000\200\000\000\000\000\000\000\000"},
-	{274, "import_stmt", 0, 10, states_18,
+	{274, "import_stmt", 0, 8, states_18,
 	 "\000\000\000\000\000\006\000\000\000\000\000\000"},
 	{275, "compound_stmt", 0, 2, states_19,
 	 "\000\020\000\000\000\000\262\000\000\000\000\001"},
@@ -1062,9 +2054,33 @@ static label labels[91] = {
 	{296, 0},
 	{297, 0},
 };
+static short kwlabels[58] = {
+	41, 42, -1, 55, 49, -1, 30, -1, 53, -1, 50, -1, 54, -1, -1, 52,
+	-1, 70, 65, 51, -1, -1, 62, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	-1, 33, 38, -1, -1, -1, -1, 39, 58, 88, 12, -1, -1, -1, 64, -1,
+	32, -1, -1, -1, -1, 37, -1, 57, -1, -1,
+};
+static short toklabels[30] = {
+	7, 13, 84, 85, 2, 59, 60, 17, 19, 79, 80, 15, 21, -1, 72, 73,
+	43, 75, -1, -1, 68, 69, 29, 87, 76, 83, 81, 82, -1, -1,
+};
+#ifdef DIRECT_PARSER
+extern int gramparse();
+#endif
 grammar gram = {
 	42,
 	dfas,
 	{91, labels},
-	256
+	256,
+	1,
+	1,
+	58,
+	30,
+	kwlabels,
+	toklabels,
+#ifdef DIRECT_PARSER
+	gramparse
+#else
+	0
+#endif
 };
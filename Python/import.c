@@ -5,11 +5,16 @@
 
 #include "PROTO.h"
 #include "object.h"
+#include "intobject.h"
 #include "stringobject.h"
+#include "tupleobject.h"
 #include "listobject.h"
 #include "dictobject.h"
 #include "moduleobject.h"
+#include "objimpl.h"
 #include "node.h"
+#include "grammar.h"
+#include "parsetok.h"
 #include "context.h"
 #include "token.h"
 #include "graminit.h"
@@ -18,6 +23,34 @@
 #include "import.h"
 #include "errcode.h"
 #include "sysmodule.h"
+#include "errors.h"
+#include "compile.h"
+#include "marshal.h"
+#include "frozen.h"
+
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#ifndef THINK_C
+#define USE_DIRCACHE
+#endif
+
+#ifdef USE_DIRCACHE
+#ifdef __STDC__
+#include <time.h>
+#else
+extern long time();
+#endif
+#ifdef SYSV
+#include <dirent.h>
+#define direct dirent
+#else
+#include <sys/dir.h>
+#endif
+#endif /* USE_DIRCACHE */
+
+extern void exec_code PROTO((context *, codeobject *)); /* From ceval.c */
+extern grammar gram; /* From graminit.c */
 
 /* Define pathname separator and delimiter in $PYTHONPATH */
 
@@ -140,19 +173,216 @@ setpythonpath(path)
 	}
 }
 
+#ifndef MAXPATHLEN
+#define MAXPATHLEN 256
+#endif
+
+#ifdef USE_DIRCACHE
+
+/* Cache of directory listings.
+   Searching sys.path used to try fopen() on every directory until one
+   succeeded, so most imports made several failing system calls.  Now
+   each directory is read once and its file names are kept in a
+   dictionary.  A directory is stat()ed at most once per top-level
+   import, to see if it was modified since it was read; the other
+   lookups made by that import, including those of the imports done by
+   the modules it loads, are dictionary lookups only.
+   A directory modified in the same second it was read may have changed
+   unnoticed afterwards, so it is read again by the next import. */
+
+struct dircache {
+	struct dircache *dc_next;
+	char *dc_path;
+	long dc_mtime;		/* Modification time when read */
+	long dc_read;		/* Time when read */
+	long dc_checked;	/* Value of dc_generation when checked */
+	int dc_missing;		/* Directory didn't exist when checked */
+	object *dc_names;	/* Dictionary of file names, or NULL */
+};
+
+static struct dircache *dircaches;
+static long dc_generation;	/* Incremented by each top-level import */
+
+/* Start a new top-level import: check directories for changes again */
+
+#define dircache_newimport() (dc_generation++)
+
+/* Statistics, returned by sys.importstats() */
+
+static long ds_lookups;		/* Files looked up in the cache */
+static long ds_listings;	/* Directories (re)read */
+static long ds_saved;		/* Failing opens avoided */
+
+static object *
+read_directory(path)
+	char *path;
+{
+	DIR *dirp;
+	struct direct *ep;
+	object *d;
+	if ((dirp = opendir(*path == '\0' ? "." : path)) == NULL)
+		return NULL;
+	ds_listings++;
+	d = newdictobject();
+	while (d != NULL && (ep = readdir(dirp)) != NULL) {
+		if (dictinsert(d, ep->d_name, None) != 0) {
+			DECREF(d);
+			d = NULL;
+		}
+	}
+	closedir(dirp);
+	return d;
+}
+
+/* Look for a file in a directory.
+   Return 1 if it exists, 0 if not, and -1 if we can't tell from
+   the cache (e.g., the directory is unreadable) */
+
+static int
+dircache_lookup(dirname, filename)
+	char *dirname;
+	char *filename;
+{
+	struct dircache *dc;
+	struct stat st;
+	char buf[MAXPATHLEN];
+	int len = strlen(dirname);
+	/* Strip trailing separators, so "lib/" and "lib" are the same */
+	if (len >= MAXPATHLEN)
+		return -1;
+	while (len > 1 && dirname[len-1] == SEP)
+		len--;
+	strncpy(buf, dirname, len);
+	buf[len] = '\0';
+	dirname = buf;
+	for (dc = dircaches; dc != NULL; dc = dc->dc_next) {
+		if (strcmp(dc->dc_path, dirname) == 0)
+			break;
+	}
+	if (dc == NULL) {
+		dc = NEW(struct dircache, 1);
+		if (dc == NULL)
+			return -1;
+		dc->dc_path = malloc(strlen(dirname) + 1);
+		if (dc->dc_path == NULL) {
+			DEL(dc);
+			return -1;
+		}
+		strcpy(dc->dc_path, dirname);
+		dc->dc_names = NULL;
+		dc->dc_checked = dc_generation - 1;
+		dc->dc_next = dircaches;
+		dircaches = dc;
+	}
+	ds_lookups++;
+	if (dc->dc_checked != dc_generation) {
+		dc->dc_checked = dc_generation;
+		dc->dc_missing = stat(*dirname == '\0' ? "." : dirname, &st) != 0;
+		if (dc->dc_missing) {
+			/* No such directory (any more) */
+			if (dc->dc_names != NULL) {
+				DECREF(dc->dc_names);
+				dc->dc_names = NULL;
+			}
+		}
+		else if (dc->dc_names == NULL ||
+				dc->dc_mtime != (long)st.st_mtime ||
+				dc->dc_mtime >= dc->dc_read) {
+			if (dc->dc_names != NULL) {
+				DECREF(dc->dc_names);
+			}
+			dc->dc_read = (long)time((time_t *)NULL);
+			dc->dc_mtime = (long)st.st_mtime;
+			dc->dc_names = read_directory(dirname);
+			if (dc->dc_names == NULL)
+				err_clear();
+		}
+	}
+	if (dc->dc_missing) {
+		ds_saved++;
+		return 0;
+	}
+	if (dc->dc_names == NULL)
+		return -1; /* Unreadable; try it the slow way */
+	if (dictlookup(dc->dc_names, filename) != NULL)
+		return 1;
+	ds_saved++;
+	return 0;
+}
+
+/* See if a file exists, given its full pathname */
+
+static int
+file_exists(pathname)
+	char *pathname;
+{
+	char dirname[MAXPATHLEN];
+	char *p = strrchr(pathname, SEP);
+	int len;
+	if (p == NULL)
+		return dircache_lookup("", pathname);
+	len = p - pathname;
+	if (len == 0)
+		len = 1; /* The root directory */
+	if (len >= MAXPATHLEN)
+		return -1;
+	strncpy(dirname, pathname, len);
+	dirname[len] = '\0';
+	return dircache_lookup(dirname, p+1);
+}
+
+#else /* !USE_DIRCACHE */
+
+#define dircache_newimport() /* empty */
+#define dircache_lookup(dirname, filename) (-1)
+#define file_exists(pathname) (-1)
+
+#endif /* !USE_DIRCACHE */
+
+object *
+import_stats()
+{
+	object *v = newtupleobject(3);
+	if (v != NULL) {
+#ifdef USE_DIRCACHE
+		settupleitem(v, 0, newintobject(ds_lookups));
+		settupleitem(v, 1, newintobject(ds_listings));
+		settupleitem(v, 2, newintobject(ds_saved));
+#else
+		settupleitem(v, 0, newintobject(0L));
+		settupleitem(v, 1, newintobject(0L));
+		settupleitem(v, 2, newintobject(0L));
+#endif
+		if (err_occurred()) {
+			DECREF(v);
+			v = NULL;
+		}
+	}
+	return v;
+}
+
+/* Open a module's source file; its pathname is left in namebuf,
+   which must have room for MAXPATHLEN characters.
+   Path entries that would make the pathname too long are skipped. */
+
 static FILE *
-open_module(name, suffix)
+open_module(name, suffix, namebuf)
 	char *name;
 	char *suffix;
+	char *namebuf;
 {
 	object *path;
-	char namebuf[256];
 	FILE *fp;
+	char filename[MAXPATHLEN];
+	int namelen = strlen(name) + strlen(suffix);
 	
+	if (namelen >= MAXPATHLEN)
+		return NULL;
+	strcpy(filename, name);
+	strcat(filename, suffix);
 	path = sysget("path");
 	if (path == NULL || !is_listobject(path)) {
-		strcpy(namebuf, name);
-		strcat(namebuf, suffix);
+		strcpy(namebuf, filename);
 		fp = fopen(namebuf, "r");
 	}
 	else {
@@ -164,12 +394,15 @@ open_module(name, suffix)
 			int len;
 			if (!is_stringobject(v))
 				continue;
-			strcpy(namebuf, getstringvalue(v));
 			len = getstringsize(v);
+			if (len + 1 + namelen >= MAXPATHLEN)
+				continue;
+			if (dircache_lookup(getstringvalue(v), filename) == 0)
+				continue;
+			strcpy(namebuf, getstringvalue(v));
 			if (len > 0 && namebuf[len-1] != SEP)
 				namebuf[len++] = SEP;
-			strcpy(namebuf+len, name); /* XXX check for overflow */
-			strcat(namebuf, suffix); /* XXX ditto */
+			strcpy(namebuf+len, filename);
 			fp = fopen(namebuf, "r");
 			if (fp != NULL)
 				break;
@@ -178,6 +411,225 @@ open_module(name, suffix)
 	return fp;
 }
 
+/* Frozen modules are found in a table linked into the interpreter;
+   they take precedence over modules found along sys.path */
+
+static struct frozen *
+find_frozen(name)
+	char *name;
+{
+	struct frozen *p;
+	for (p = frozen_modules; p->name != NULL; p++) {
+		if (strcmp(p->name, name) == 0)
+			return p;
+	}
+	return NULL;
+}
+
+static codeobject *
+get_frozen_code(ctx, p)
+	context *ctx;
+	struct frozen *p;
+{
+	unsigned char *s = p->code;
+	object *co;
+	/* The code starts with the MAGIC of the freeze that wrote it */
+	if (p->size < 4 || (s[0] | s[1] << 8 | (long)s[2] << 16 |
+			(long)s[3] << 24) != (MAGIC & 0xffffffffL)) {
+		error(ctx, "frozen module code is out of date");
+		return NULL;
+	}
+	co = rds_object((char *)s + 4, p->size - 4);
+	if (co == NULL || !is_codeobject(co)) {
+		if (co != NULL) {
+			DECREF(co);
+		}
+		err_clear();
+		error(ctx, "bad frozen module code");
+		return NULL;
+	}
+	return (codeobject *)co;
+}
+
+/* Compiled modules are cached in a file whose name is that of the
+   source file with a 'c' appended.  It holds MAGIC, the modification
+   time and size of the source it was compiled from, and the marshalled
+   code object.  A cache file that doesn't match the source is simply
+   ignored and rewritten.  Cache files hold optimized code, so they are
+   neither read nor written when the optimizer is off (PYTHONNOOPT). */
+
+extern int optimizing; /* From compile.c */
+
+static codeobject *
+read_compiled(pathname, mtime, size)
+	char *pathname;
+	long mtime, size;
+{
+	char cpathname[MAXPATHLEN+1];
+	FILE *fp;
+	object *co;
+	if (!optimizing || strlen(pathname) + 1 > MAXPATHLEN)
+		return NULL;
+	strcpy(cpathname, pathname);
+	strcat(cpathname, "c");
+	if (file_exists(cpathname) == 0)
+		return NULL;
+	fp = fopen(cpathname, "rb");
+	if (fp == NULL)
+		return NULL;
+	if (rd_long(fp) != MAGIC ||
+		(rd_long(fp) & 0xffffffffL) != (mtime & 0xffffffffL) ||
+		(rd_long(fp) & 0xffffffffL) != (size & 0xffffffffL)) {
+		fclose(fp);
+		return NULL;
+	}
+	co = rd_object(fp);
+	fclose(fp);
+	if (co == NULL || !is_codeobject(co)) {
+		/* Bad cache file; use the source */
+		if (co != NULL) {
+			DECREF(co);
+		}
+		err_clear();
+		return NULL;
+	}
+	return (codeobject *)co;
+}
+
+static void
+write_compiled(co, pathname, mtime, size)
+	codeobject *co;
+	char *pathname;
+	long mtime, size;
+{
+	extern int unlink PROTO((const char *));
+	char cpathname[MAXPATHLEN+1];
+	FILE *fp;
+	int ok;
+	if (!optimizing || strlen(pathname) + 1 > MAXPATHLEN)
+		return;
+	strcpy(cpathname, pathname);
+	strcat(cpathname, "c");
+	fp = fopen(cpathname, "wb");
+	if (fp == NULL)
+		return; /* Can't write here; that's OK */
+	/* The magic word goes in last, so an interrupted or failed
+	   write never leaves a file that looks valid */
+	wr_long(0L, fp);
+	wr_long(mtime, fp);
+	wr_long(size, fp);
+	ok = wr_object((object *)co, fp) == 0;
+	ok = ok && fflush(fp) == 0 && !ferror(fp);
+	if (ok) {
+		fseek(fp, 0L, 0);
+		wr_long(MAGIC, fp);
+		ok = !ferror(fp);
+	}
+	if (fclose(fp) != 0 || !ok)
+		unlink(cpathname);
+}
+
+/* Get the code for a module from the cache file if it is up to date,
+   else by compiling the source (and updating the cache).
+   On failure, report the error in ctx and return NULL. */
+
+static codeobject *
+get_module_code(ctx, fp, pathname)
+	context *ctx;
+	FILE *fp;
+	char *pathname;
+{
+	struct stat st;
+	int have_stat;
+	codeobject *co;
+	node *n;
+	int err;
+	have_stat = fstat(fileno(fp), &st) == 0;
+	if (have_stat) {
+		co = read_compiled(pathname, (long)st.st_mtime,
+						(long)st.st_size);
+		if (co != NULL)
+			return co;
+	}
+	err = parseinput(fp, file_input, &n);
+	if (err != E_DONE) {
+		input_error(ctx, err);
+		return NULL;
+	}
+	co = compile(n);
+	freetree(n);
+	if (co == NULL) {
+		puterrno(ctx);
+		return NULL;
+	}
+	if (have_stat)
+		write_compiled(co, pathname, (long)st.st_mtime,
+						(long)st.st_size);
+	return co;
+}
+
+/* Statement-at-a-time import.
+   When it is on, a module whose compiled file is missing or out of
+   date is parsed, compiled and executed one top-level statement at a
+   time, so that only one statement's parse tree exists at any time.
+   No compiled file is written for it, since there is no code object
+   for the whole module. */
+
+static int stream_import;
+
+void
+setstreamimport(flag)
+	int flag;
+{
+	stream_import = flag;
+}
+
+/* Get the code for a module from its compiled file only, or NULL */
+
+static codeobject *
+get_cached_code(fp, pathname)
+	FILE *fp;
+	char *pathname;
+{
+	struct stat st;
+	if (fstat(fileno(fp), &st) != 0)
+		return NULL;
+	return read_compiled(pathname, (long)st.st_mtime, (long)st.st_size);
+}
+
+/* Execute a module's source in the current context a statement at
+   a time; errors are reported in ctx */
+
+static void
+exec_stmts(ctx, fp)
+	context *ctx;
+	FILE *fp;
+{
+	struct stmtfile *sf;
+	codeobject *co;
+	node *n;
+	int err;
+	if ((sf = openstmts(fp)) == NULL) {
+		input_error(ctx, E_NOMEM);
+		return;
+	}
+	while ((err = parsestmt(sf, &gram, stmt, &n)) == E_DONE) {
+		co = compile(n);
+		freetree(n);
+		if (co == NULL) {
+			puterrno(ctx);
+			break;
+		}
+		exec_code(ctx, co);
+		DECREF(co);
+		if (ctx->ctx_exception)
+			break;
+	}
+	if (err != E_DONE && err != E_EOF)
+		input_error(ctx, err);
+	closestmts(sf);
+}
+
 static object *
 load_module(ctx, name)
 	context *ctx;
@@ -185,39 +637,55 @@ load_module(ctx, name)
 {
 	object *m;
 	char **p;
-	FILE *fp;
-	node *n;
-	int err;
+	FILE *fp, *stream = NULL;
+	codeobject *co;
+	struct frozen *frozen;
 	object *mtab;
 	object *save_locals, *save_globals;
+	char pathname[MAXPATHLEN];
 	
 	mtab = sysget("modules");
 	if (mtab == NULL || !is_dictobject(mtab)) {
 		errno = EBADF;
 		return NULL;
 	}
-	fp = open_module(name, ".py");
-	if (fp == NULL) {
-		name_error(ctx, name);
-		return NULL;
+	if ((frozen = find_frozen(name)) != NULL)
+		co = get_frozen_code(ctx, frozen);
+	else {
+		fp = open_module(name, ".py", pathname);
+		if (fp == NULL) {
+			name_error(ctx, name);
+			return NULL;
+		}
+		co = NULL;
+		if (stream_import &&
+			(co = get_cached_code(fp, pathname)) == NULL)
+			stream = fp; /* Closed after executing it */
+		else {
+			if (co == NULL)
+				co = get_module_code(ctx, fp, pathname);
+			fclose(fp);
+		}
 	}
-	err = parseinput(fp, file_input, &n);
-	fclose(fp);
-	if (err != E_DONE) {
-		input_error(ctx, err);
+	if (co == NULL && stream == NULL)
 		return NULL;
-	}
 	save_locals = ctx->ctx_locals;
 	INCREF(save_locals);
 	save_globals = ctx->ctx_globals;
 	INCREF(save_globals);
 	define_module(ctx, name);
-	exec_node(ctx, n);
+	if (stream != NULL) {
+		exec_stmts(ctx, stream);
+		fclose(stream);
+	}
+	else {
+		exec_code(ctx, co);
+		DECREF(co);
+	}
 	DECREF(ctx->ctx_locals);
 	ctx->ctx_locals = save_locals;
 	DECREF(ctx->ctx_globals);
 	ctx->ctx_globals = save_globals;
-	/* XXX need to free the tree n here; except referenced defs */
 	if (ctx->ctx_exception) {
 		dictremove(mtab, name); /* Undefine the module */
 		return NULL;
@@ -230,6 +698,189 @@ load_module(ctx, name)
 	return m;
 }
 
+/* Lazy import mode.
+   When it is on, built-in modules registered with initbuiltin() are
+   initialized when they are first imported, and "import" of a .py
+   module only checks that the module exists and binds an empty
+   placeholder module; the module is loaded into the placeholder when
+   one of its attributes is first used (see load_lazy_module()).
+   Errors in the module are then reported at that point.  The
+   placeholder then stays in sys.modules, emptied and still lazy, so
+   every later use runs the module again from scratch (and reports
+   the error again if it persists). */
+
+static int lazy_import;
+
+void
+setlazyimport(flag)
+	int flag;
+{
+	lazy_import = flag;
+}
+
+#define MAXBUILTINS 20
+
+static struct {
+	char *name;
+	void (*initfunc) FPROTO((void));	/* NULL when done */
+} builtins[MAXBUILTINS];
+static int nbuiltins;
+
+/* Initialize a built-in module now or, in lazy mode, at first import */
+
+void
+initbuiltin(name, initfunc)
+	char *name;
+	void (*initfunc) FPROTO((void));
+{
+	if (lazy_import && nbuiltins < MAXBUILTINS) {
+		builtins[nbuiltins].name = name;
+		builtins[nbuiltins].initfunc = initfunc;
+		nbuiltins++;
+	}
+	else
+		(*initfunc)();
+}
+
+static int
+init_lazy_builtin(name)
+	char *name;
+{
+	int i;
+	void (*initfunc) FPROTO((void));
+	for (i = 0; i < nbuiltins; i++) {
+		if (builtins[i].initfunc != NULL &&
+				strcmp(builtins[i].name, name) == 0) {
+			initfunc = builtins[i].initfunc;
+			builtins[i].initfunc = NULL;
+			(*initfunc)();
+			return 1;
+		}
+	}
+	return 0;
+}
+
+static object *
+lazy_module(ctx, name)
+	context *ctx;
+	char *name;
+{
+	object *m;
+	FILE *fp;
+	char pathname[MAXPATHLEN];
+	if (find_frozen(name) == NULL) {
+		fp = open_module(name, ".py", pathname);
+		if (fp == NULL) {
+			name_error(ctx, name);
+			return NULL;
+		}
+		fclose(fp);
+	}
+	m = new_module(name);
+	if (m == NULL) {
+		puterrno(ctx);
+		return NULL;
+	}
+	setmodulelazy(m, 1);
+	DECREF(m);
+	return m; /* It still exists, in sys.modules */
+}
+
+/* Remove everything from a module's dictionary */
+
+static void
+clear_module(m)
+	object *m;
+{
+	object *d = getmoduledict(m);
+	object *keys = getdictkeys(d);
+	int i;
+	if (keys == NULL) {
+		err_clear();
+		return;
+	}
+	for (i = getlistsize(keys); --i >= 0; )
+		dictremove(d, getstringvalue(getlistitem(keys, i)));
+	DECREF(keys);
+}
+
+/* Nesting of imports done while loading modules */
+
+static int import_nesting;
+
+/* Load a module that was imported lazily.
+   Return 0 if OK (or m is not such a module), -1 for errors */
+
+int
+load_lazy_module(ctx, m)
+	context *ctx;
+	object *m;
+{
+	char *name;
+	FILE *fp, *stream = NULL;
+	codeobject *co;
+	struct frozen *frozen;
+	object *save_locals, *save_globals;
+	char pathname[MAXPATHLEN];
+	if (!is_moduleobject(m) || getmodulelazy(m) <= 0)
+		return 0;
+	if (import_nesting == 0)
+		dircache_newimport();
+	/* Not lazy while it is being loaded, so uses of m by the module
+	   itself don't start another load; made lazy again on failure */
+	setmodulelazy(m, 0);
+	name = getmodulename(m);
+	if ((frozen = find_frozen(name)) != NULL)
+		co = get_frozen_code(ctx, frozen);
+	else {
+		fp = open_module(name, ".py", pathname);
+		if (fp == NULL) {
+			setmodulelazy(m, 1);
+			name_error(ctx, name);
+			return -1;
+		}
+		co = NULL;
+		if (stream_import &&
+			(co = get_cached_code(fp, pathname)) == NULL)
+			stream = fp; /* Closed after executing it */
+		else {
+			if (co == NULL)
+				co = get_module_code(ctx, fp, pathname);
+			fclose(fp);
+		}
+	}
+	if (co == NULL && stream == NULL) {
+		setmodulelazy(m, 1);
+		return -1;
+	}
+	save_locals = ctx->ctx_locals;
+	INCREF(save_locals);
+	save_globals = ctx->ctx_globals;
+	INCREF(save_globals);
+	use_module(ctx, getmoduledict(m));
+	import_nesting++;
+	if (stream != NULL) {
+		exec_stmts(ctx, stream);
+		fclose(stream);
+	}
+	else {
+		exec_code(ctx, co);
+		DECREF(co);
+	}
+	import_nesting--;
+	DECREF(ctx->ctx_locals);
+	ctx->ctx_locals = save_locals;
+	DECREF(ctx->ctx_globals);
+	ctx->ctx_globals = save_globals;
+	if (ctx->ctx_exception) {
+		/* Start the next attempt from an empty module */
+		clear_module(m);
+		setmodulelazy(m, 1);
+		return -1;
+	}
+	return 0;
+}
+
 object *
 import_module(ctx, name)
 	context *ctx;
@@ -243,7 +894,19 @@ import_module(ctx, name)
 		return NULL;
 	}
 	if ((m = dictlookup(mtab, name)) == NULL) {
-		m = load_module(ctx, name);
+		if (import_nesting == 0)
+			dircache_newimport();
+		import_nesting++;
+		if (init_lazy_builtin(name)) {
+			m = dictlookup(mtab, name);
+			if (m == NULL)
+				error(ctx, "built-in module not defined after init");
+		}
+		else if (lazy_import)
+			m = lazy_module(ctx, name);
+		else
+			m = load_module(ctx, name);
+		import_nesting--;
 	}
 	return m;
 }
@@ -255,37 +918,45 @@ reload_module(ctx, m)
 {
 	char *name;
 	FILE *fp;
-	node *n;
-	int err;
+	codeobject *co;
+	struct frozen *frozen;
 	object *d;
 	object *save_locals, *save_globals;
+	char pathname[MAXPATHLEN];
 	if (m == NULL || !is_moduleobject(m)) {
 		type_error(ctx, "reload() argument must be module");
 		return NULL;
 	}
 	/* XXX Ought to check for builtin module */
 	name = getmodulename(m);
-	fp = open_module(name, ".py");
-	if (fp == NULL) {
-		error(ctx, "reload() cannot find module source file");
-		return NULL;
+	dircache_newimport();
+	setmodulelazy(m, 0);
+	if ((frozen = find_frozen(name)) != NULL)
+		co = get_frozen_code(ctx, frozen);
+	else {
+		fp = open_module(name, ".py", pathname);
+		if (fp == NULL) {
+			error(ctx, "reload() cannot find module source file");
+			return NULL;
+		}
+		co = get_module_code(ctx, fp, pathname);
+		fclose(fp);
 	}
-	err = parseinput(fp, file_input, &n);
-	fclose(fp);
-	if (err != E_DONE) {
-		input_error(ctx, err);
+	if (co == NULL)
 		return NULL;
-	}
 	d = newdictobject();
-	if (d == NULL)
+	if (d == NULL) {
+		DECREF(co);
 		return NULL;
+	}
 	setmoduledict(m, d);
 	save_locals = ctx->ctx_locals;
 	INCREF(save_locals);
 	save_globals = ctx->ctx_globals;
 	INCREF(save_globals);
 	use_module(ctx, d);
-	exec_node(ctx, n);
+	exec_code(ctx, co);
+	DECREF(co);
 	DECREF(ctx->ctx_locals);
 	ctx->ctx_locals = save_locals;
 	DECREF(ctx->ctx_globals);
@@ -0,0 +1,751 @@
+/* Write objects to a file or string and read them back.
+   This is used for the compiled module cache (".pyc" files) and
+   by the built-in module 'marshal'. */
+
+#include <stdio.h>
+#include "string.h"
+
+#include "PROTO.h"
+#include "object.h"
+#include "intobject.h"
+#include "longobject.h"
+#include "floatobject.h"
+#include "stringobject.h"
+#include "tupleobject.h"
+#include "listobject.h"
+#include "dictobject.h"
+#include "fileobject.h"
+#include "methodobject.h"
+#include "moduleobject.h"
+#include "objimpl.h"
+#include "import.h"
+#include "modsupport.h"
+#include "errors.h"
+#include "compile.h"
+#include "marshal.h"
+
+extern codeobject *newcodeobject
+		PROTO((object *, object *, object *, object *));
+					/* From compile.c */
+
+#define TYPE_NULL	'0'
+#define TYPE_NONE	'N'
+#define TYPE_INT	'i'
+#define TYPE_INT64	'I'
+#define TYPE_FLOAT	'f'
+#define TYPE_LONG	'l'
+#define TYPE_STRING	's'
+#define TYPE_TUPLE	'('
+#define TYPE_LIST	'['
+#define TYPE_DICT	'{'
+#define TYPE_CODE	'c'
+#define TYPE_UNKNOWN	'?'
+
+/* Format version written in front of each object by the marshal
+   module's dump() and dumps(); bump it when the format changes */
+
+#define MARSHAL_VERSION	1
+
+#define MAX_DEPTH	1000	/* Deeper structures are probably cyclic */
+
+/* Output goes either to a file or to a string object that grows as
+   needed; error records unmarshallable objects and such */
+
+typedef struct {
+	FILE *fp;
+	int error;
+	int depth;
+	object *str;	/* Only if fp == NULL */
+	char *ptr;
+	char *end;
+} WFILE;
+
+#define WERR_NONE	0
+#define WERR_UNMARSHALLABLE	1
+#define WERR_NESTED	2
+#define WERR_NOMEM	3
+
+#define w_byte(c, p) do { \
+			if ((p)->fp) putc((c), (p)->fp); \
+			else if ((p)->ptr != (p)->end) *(p)->ptr++ = (c); \
+			else w_more(c, p); \
+		} while (0)
+
+static void
+w_more(c, p)
+	int c;
+	WFILE *p;
+{
+	int size, newsize;
+	if (p->str == NULL)
+		return; /* An error already occurred */
+	size = getstringsize(p->str);
+	newsize = size + size + 1024;
+	if (resizestring(&p->str, newsize) != 0) {
+		p->ptr = p->end = NULL;
+		p->error = WERR_NOMEM;
+	}
+	else {
+		p->ptr = getstringvalue(p->str) + size;
+		p->end = getstringvalue(p->str) + newsize;
+		*p->ptr++ = c;
+	}
+}
+
+static void
+w_string(s, n, p)
+	char *s;
+	int n;
+	WFILE *p;
+{
+	if (p->fp != NULL) {
+		fwrite(s, 1, n, p->fp);
+	}
+	else {
+		while (--n >= 0) {
+			w_byte(*s, p);
+			s++;
+		}
+	}
+}
+
+static void
+w_short(x, p)
+	int x;
+	WFILE *p;
+{
+	w_byte(x & 0xff, p);
+	w_byte((x>>8) & 0xff, p);
+}
+
+static void
+w_long(x, p)
+	long x;
+	WFILE *p;
+{
+	w_byte((int)( x      & 0xff), p);
+	w_byte((int)((x>> 8) & 0xff), p);
+	w_byte((int)((x>>16) & 0xff), p);
+	w_byte((int)((x>>24) & 0xff), p);
+}
+
+static void
+w_object(v, p)
+	object *v;
+	WFILE *p;
+{
+	long i, n;
+
+	if (++p->depth > MAX_DEPTH) {
+		p->error = WERR_NESTED;
+	}
+	else if (v == NULL)
+		w_byte(TYPE_NULL, p);
+	else if (v == None)
+		w_byte(TYPE_NONE, p);
+	else if (is_intobject(v)) {
+		long x = getintvalue(v);
+		long y = x>>31;
+		if (y != 0 && y != -1) {
+			/* Doesn't fit in 32 bits */
+			w_byte(TYPE_INT64, p);
+			w_long(x, p);
+			w_long(x>>16>>16, p);
+		}
+		else {
+			w_byte(TYPE_INT, p);
+			w_long(x, p);
+		}
+	}
+	else if (is_longobject(v)) {
+		longobject *ob = (longobject *)v;
+		w_byte(TYPE_LONG, p);
+		n = ob->ob_size;
+		w_long(ob->ob_neg ? -n : n, p);
+		for (i = 0; i < n; i++)
+			w_short(ob->ob_digit[i], p);
+	}
+	else if (is_floatobject(v)) {
+		char buf[256];
+		/* 17 significant digits always read back exactly */
+		sprintf(buf, "%.17g", getfloatvalue(v));
+		n = strlen(buf);
+		w_byte(TYPE_FLOAT, p);
+		w_byte((int)n, p);
+		w_string(buf, (int)n, p);
+	}
+	else if (is_stringobject(v)) {
+		w_byte(TYPE_STRING, p);
+		n = getstringsize(v);
+		w_long(n, p);
+		w_string(getstringvalue(v), (int)n, p);
+	}
+	else if (is_tupleobject(v)) {
+		w_byte(TYPE_TUPLE, p);
+		n = gettuplesize(v);
+		w_long(n, p);
+		for (i = 0; i < n; i++)
+			w_object(gettupleitem(v, (int)i), p);
+	}
+	else if (is_listobject(v)) {
+		sequence_methods *sq = v->ob_type->tp_as_sequence;
+		object *w;
+		w_byte(TYPE_LIST, p);
+		n = getlistsize(v);
+		w_long(n, p);
+		for (i = 0; i < n; i++) {
+			/* Not getlistitem(): that would box a list of numbers */
+			w = (*sq->sq_item)(v, (int)i);
+			if (w == NULL) {
+				err_clear();
+				p->error = WERR_NOMEM;
+			}
+			w_object(w, p);
+			if (w != NULL) {
+				DECREF(w);
+			}
+		}
+	}
+	else if (is_dictobject(v)) {
+		object *keys = getdictkeys(v);
+		char *key;
+		w_byte(TYPE_DICT, p);
+		n = keys == NULL ? 0 : getlistsize(keys);
+		if (keys == NULL) {
+			err_clear();
+			p->error = WERR_NOMEM;
+		}
+		w_long(n, p);
+		/* Keys are always strings; write them without a type code */
+		for (i = 0; i < n; i++) {
+			key = getstringvalue(getlistitem(keys, (int)i));
+			w_long((long)strlen(key), p);
+			w_string(key, (int)strlen(key), p);
+			w_object(dictlookup(v, key), p);
+		}
+		if (keys != NULL) {
+			DECREF(keys);
+		}
+	}
+	else if (is_codeobject(v)) {
+		codeobject *co = (codeobject *)v;
+		w_byte(TYPE_CODE, p);
+		w_object((object *)co->co_code, p);
+		w_object(co->co_consts, p);
+		w_object(co->co_names, p);
+		w_object((object *)co->co_xtable, p);
+	}
+	else {
+		w_byte(TYPE_UNKNOWN, p);
+		p->error = WERR_UNMARSHALLABLE;
+	}
+	p->depth--;
+}
+
+void
+wr_long(x, fp)
+	long x;
+	FILE *fp;
+{
+	WFILE wf;
+	wf.fp = fp;
+	w_long(x, &wf);
+}
+
+/* Return 0 if all went well, -1 if v could not be written */
+
+int
+wr_object(v, fp)
+	object *v;
+	FILE *fp;
+{
+	WFILE wf;
+	wf.fp = fp;
+	wf.error = WERR_NONE;
+	wf.depth = 0;
+	w_object(v, &wf);
+	return wf.error != WERR_NONE || ferror(fp) ? -1 : 0;
+}
+
+/* Input comes from a file or from a block of memory */
+
+typedef struct {
+	FILE *fp;
+	char *ptr;	/* Only if fp == NULL */
+	char *end;
+	int depth;
+} RFILE;
+
+#define r_byte(p) ((p)->fp ? getc((p)->fp) : \
+		   (p)->ptr != (p)->end ? (*(p)->ptr++ & 0xff) : EOF)
+
+/* Read n bytes; return the number actually read */
+
+static int
+r_string(s, n, p)
+	char *s;
+	int n;
+	RFILE *p;
+{
+	if (p->fp != NULL)
+		return fread(s, 1, n, p->fp);
+	if (p->end - p->ptr < n)
+		n = p->end - p->ptr;
+	memcpy(s, p->ptr, n);
+	p->ptr += n;
+	return n;
+}
+
+/* Return EOF if either byte is missing */
+
+static int
+r_short(p)
+	RFILE *p;
+{
+	register int x, y;
+	x = r_byte(p);
+	y = r_byte(p);
+	if (x == EOF || y == EOF)
+		return EOF;
+	return x | y << 8;
+}
+
+static long
+r_long(p)
+	RFILE *p;
+{
+	register long x;
+	x = r_byte(p);
+	x |= (long)r_byte(p) << 8;
+	x |= (long)r_byte(p) << 16;
+	x |= (long)r_byte(p) << 24;
+	/* Sign extension for 64-bit machines */
+	x <<= (8*sizeof(long) - 32);
+	x >>= (8*sizeof(long) - 32);
+	return x;
+}
+
+/* Check a count of n items read from p, each taking at least a byte:
+   it must fit in an int, and a string must have that much data left */
+
+#define bad_count(n, p) ((n) < 0 || (long)(int)(n) != (n) || \
+			 (p)->fp == NULL && (n) > (p)->end - (p)->ptr)
+
+static object *
+bad_data()
+{
+	err_setstr(RuntimeError, "bad marshal data");
+	return NULL;
+}
+
+static object *r_object PROTO((RFILE *));
+
+static object *
+r_item(p)
+	RFILE *p;
+{
+	object *v;
+	long i, n;
+	int type = r_byte(p);
+
+	switch (type) {
+
+	case EOF:
+		err_setstr(EOFError, "EOF read where object expected");
+		return NULL;
+
+	case TYPE_NULL:
+		return bad_data();
+
+	case TYPE_NONE:
+		INCREF(None);
+		return None;
+
+	case TYPE_INT:
+		return newintobject(r_long(p));
+
+	case TYPE_INT64:
+		{
+			unsigned long lo = r_long(p) & 0xffffffffL;
+			long hi = r_long(p);
+			if (sizeof(long) <= 4) {
+				err_setstr(OverflowError,
+					"marshalled integer too large");
+				return NULL;
+			}
+			return newintobject((long)((hi<<16<<16) | lo));
+		}
+
+	case TYPE_LONG:
+		{
+			longobject *ob;
+			n = r_long(p);
+			if (p->fp == NULL && (n < 0 ? -n : n) > p->end - p->ptr)
+				return bad_data();
+			ob = alloclongobject((int)(n < 0 ? -n : n));
+			if (ob == NULL)
+				return NULL;
+			ob->ob_neg = n < 0;
+			for (i = 0; i < ob->ob_size; i++) {
+				int d = r_short(p);
+				if (d == EOF) {
+					DECREF(ob);
+					return bad_data();
+				}
+				ob->ob_digit[i] = d & MASK;
+			}
+			/* Strip leading zero digits; zero is never negative */
+			while (ob->ob_size > 0 &&
+			       ob->ob_digit[ob->ob_size-1] == 0)
+				ob->ob_size--;
+			if (ob->ob_size == 0)
+				ob->ob_neg = 0;
+			return (object *)ob;
+		}
+
+	case TYPE_FLOAT:
+		{
+			char buf[256];
+			char *end;
+			double x;
+			n = r_byte(p);
+			if (n == EOF || r_string(buf, (int)n, p) != n)
+				return bad_data();
+			buf[n] = '\0';
+			x = parsefloat(buf, &end);
+			if (end != buf+n)
+				return bad_data();
+			return newfloatobject(x);
+		}
+
+	case TYPE_STRING:
+		n = r_long(p);
+		if (bad_count(n, p))
+			return bad_data();
+		v = newsizedstringobject((char *)NULL, (int)n);
+		if (v != NULL) {
+			if (r_string(getstringvalue(v), (int)n, p) != n) {
+				DECREF(v);
+				return bad_data();
+			}
+		}
+		return v;
+
+	case TYPE_TUPLE:
+		n = r_long(p);
+		if (bad_count(n, p))
+			return bad_data();
+		v = newtupleobject((int)n);
+		if (v == NULL)
+			return NULL;
+		for (i = 0; i < n; i++) {
+			object *w = r_object(p);
+			if (w == NULL) {
+				DECREF(v);
+				return NULL;
+			}
+			settupleitem(v, (int)i, w);
+		}
+		return v;
+
+	case TYPE_LIST:
+		n = r_long(p);
+		if (bad_count(n, p))
+			return bad_data();
+		v = newlistobject(0);
+		if (v == NULL)
+			return NULL;
+		for (i = 0; i < n; i++) {
+			/* Appending lets a list of numbers stay unboxed */
+			object *w = r_object(p);
+			if (w == NULL || addlistitem(v, w) != 0) {
+				if (w != NULL) {
+					DECREF(w);
+				}
+				DECREF(v);
+				return NULL;
+			}
+			DECREF(w);
+		}
+		return v;
+
+	case TYPE_DICT:
+		n = r_long(p);
+		if (bad_count(n, p))
+			return bad_data();
+		v = newdictobject();
+		if (v == NULL)
+			return NULL;
+		for (i = 0; i < n; i++) {
+			object *key, *w;
+			long len = r_long(p);
+			if (bad_count(len, p)) {
+				DECREF(v);
+				return bad_data();
+			}
+			key = newsizedstringobject((char *)NULL, (int)len);
+			if (key == NULL) {
+				DECREF(v);
+				return NULL;
+			}
+			if (r_string(getstringvalue(key), (int)len, p) != len) {
+				DECREF(key);
+				DECREF(v);
+				return bad_data();
+			}
+			w = r_object(p);
+			if (w == NULL ||
+				dictinsert(v, getstringvalue(key), w) != 0) {
+				if (w != NULL) {
+					DECREF(w);
+					err_nomem();
+				}
+				DECREF(key);
+				DECREF(v);
+				return NULL;
+			}
+			DECREF(w);
+			DECREF(key);
+		}
+		return v;
+
+	case TYPE_CODE:
+		{
+			object *code = r_object(p);
+			object *consts = code == NULL ? NULL : r_object(p);
+			object *names = consts == NULL ? NULL : r_object(p);
+			object *xtable = names == NULL ? NULL : r_object(p);
+			v = NULL;
+			if (xtable != NULL)
+				v = (object *)newcodeobject(code, consts, names,
+									xtable);
+			if (code != NULL) {
+				DECREF(code);
+			}
+			if (consts != NULL) {
+				DECREF(consts);
+			}
+			if (names != NULL) {
+				DECREF(names);
+			}
+			if (xtable != NULL) {
+				DECREF(xtable);
+			}
+			return v;
+		}
+
+	default:
+		return bad_data();
+
+	}
+}
+
+/* Read one object, refusing to nest deeper than the writer would */
+
+static object *
+r_object(p)
+	RFILE *p;
+{
+	object *v;
+	if (++p->depth > MAX_DEPTH) {
+		p->depth--;
+		err_setstr(RuntimeError, "marshal data too deeply nested");
+		return NULL;
+	}
+	v = r_item(p);
+	p->depth--;
+	return v;
+}
+
+long
+rd_long(fp)
+	FILE *fp;
+{
+	RFILE rf;
+	rf.fp = fp;
+	rf.depth = 0;
+	return r_long(&rf);
+}
+
+object *
+rd_object(fp)
+	FILE *fp;
+{
+	RFILE rf;
+	rf.fp = fp;
+	rf.depth = 0;
+	return r_object(&rf);
+}
+
+object *
+rds_object(str, len)
+	char *str;
+	int len;
+{
+	RFILE rf;
+	rf.fp = NULL;
+	rf.ptr = str;
+	rf.end = str + len;
+	rf.depth = 0;
+	return r_object(&rf);
+}
+
+
+/* The marshal module */
+
+/* Write the version byte and the object; report errors, if any */
+
+static object *
+dump_object(v, wf)
+	object *v;
+	WFILE *wf;
+{
+	wf->error = WERR_NONE;
+	wf->depth = 0;
+	w_byte(MARSHAL_VERSION, wf);
+	w_object(v, wf);
+	switch (wf->error) {
+	case WERR_UNMARSHALLABLE:
+		err_setstr(TypeError, "unmarshallable object");
+		return NULL;
+	case WERR_NESTED:
+		err_setstr(RuntimeError, "object too deeply nested to marshal");
+		return NULL;
+	case WERR_NOMEM:
+		return err_nomem();
+	}
+	if (wf->fp != NULL && ferror(wf->fp)) {
+		clearerr(wf->fp);
+		return err_errno(RuntimeError);
+	}
+	INCREF(None);
+	return None;
+}
+
+static object *
+check_version(p)
+	RFILE *p;
+{
+	int c = r_byte(p);
+	if (c == EOF) {
+		err_setstr(EOFError, "EOF read where object expected");
+		return NULL;
+	}
+	if (c != MARSHAL_VERSION) {
+		err_setstr(RuntimeError, "unsupported marshal format version");
+		return NULL;
+	}
+	return r_object(p);
+}
+
+/* dump(object, file) -- append object to an open file */
+
+static object *
+marshal_dump(self, args)
+	object *self;
+	object *args;
+{
+	WFILE wf;
+	object *f;
+	if (args == NULL || !is_tupleobject(args) || gettuplesize(args) != 2) {
+		err_badarg();
+		return NULL;
+	}
+	f = gettupleitem(args, 1);
+	if (f == NULL || !is_fileobject(f)) {
+		err_setstr(TypeError, "marshal.dump() 2nd arg must be file");
+		return NULL;
+	}
+	wf.fp = getfilefile(f);
+	if (wf.fp == NULL) {
+		err_setstr(RuntimeError, "marshal.dump() on closed file");
+		return NULL;
+	}
+	wf.str = NULL;
+	wf.ptr = wf.end = NULL;
+	return dump_object(gettupleitem(args, 0), &wf);
+}
+
+/* dumps(object) -- return the marshalled object as a string */
+
+static object *
+marshal_dumps(self, args)
+	object *self;
+	object *args;
+{
+	WFILE wf;
+	object *res;
+	if (args == NULL) {
+		err_setstr(TypeError, "marshal.dumps() requires an argument");
+		return NULL;
+	}
+	wf.fp = NULL;
+	wf.str = newsizedstringobject((char *)NULL, 50);
+	if (wf.str == NULL)
+		return NULL;
+	wf.ptr = getstringvalue(wf.str);
+	wf.end = wf.ptr + getstringsize(wf.str);
+	res = dump_object(args, &wf);
+	if (res == NULL) {
+		if (wf.str != NULL) {
+			DECREF(wf.str);
+		}
+		return NULL;
+	}
+	DECREF(res);
+	resizestring(&wf.str, (int) (wf.ptr - getstringvalue(wf.str)));
+	return wf.str;
+}
+
+/* load(file) -- read the next object from an open file */
+
+static object *
+marshal_load(self, args)
+	object *self;
+	object *args;
+{
+	RFILE rf;
+	if (args == NULL || !is_fileobject(args)) {
+		err_setstr(TypeError, "marshal.load() arg must be file");
+		return NULL;
+	}
+	rf.fp = getfilefile(args);
+	if (rf.fp == NULL) {
+		err_setstr(RuntimeError, "marshal.load() on closed file");
+		return NULL;
+	}
+	rf.depth = 0;
+	return check_version(&rf);
+}
+
+/* loads(string) -- the inverse of dumps() */
+
+static object *
+marshal_loads(self, args)
+	object *self;
+	object *args;
+{
+	RFILE rf;
+	object *v;
+	if (!getstrarg(args, &v))
+		return NULL;
+	rf.fp = NULL;
+	rf.ptr = getstringvalue(v);
+	rf.end = rf.ptr + getstringsize(v);
+	rf.depth = 0;
+	return check_version(&rf);
+}
+
+static struct methodlist marshal_methods[] = {
+	{"dump",	marshal_dump},
+	{"dumps",	marshal_dumps},
+	{"load",	marshal_load},
+	{"loads",	marshal_loads},
+	{NULL,		NULL}		/* sentinel */
+};
+
+void
+initmarshal()
+{
+	initmodule("marshal", marshal_methods);
+}
@@ -1,10 +1,19 @@
 /* Module support implementation */
 
 #include <stdio.h>
+#include <string.h>
+#ifdef __STDC__
+#include <stdarg.h>
+#else
+#include <varargs.h>
+#endif
 
 #include "PROTO.h"
 #include "object.h"
+#include "objimpl.h"
 #include "intobject.h"
+#include "longobject.h"
+#include "floatobject.h"
 #include "stringobject.h"
 #include "tupleobject.h"
 #include "listobject.h"
@@ -15,6 +24,113 @@
 #include "errors.h"
 
 
+/* Method tables are indexed by one hash table, keyed by the address
+   of the table and the method name, and filled in the first time a
+   table is searched.  An entry without a method marks a table as
+   entered.  Each entry also caches a method object without self,
+   which LOAD_METHOD uses to call the method without binding it. */
+
+struct methodentry {
+	struct methodlist *me_list;	/* Method table, NULL if unused */
+	struct methodlist *me_ml;	/* Method, NULL for the mark */
+	object *me_func;		/* Method object without self */
+};
+
+static struct methodentry *methodindex;
+static unsigned int indexsize;	/* Power of 2, or 0 */
+static unsigned int indexused;
+
+static unsigned int
+methodhash(list, name)
+	struct methodlist *list;
+	register char *name;
+{
+	register unsigned int h = (unsigned int)(long)list;
+	if (name != NULL) {
+		while (*name != '\0')
+			h = 31*h + (unsigned char)*name++;
+	}
+	return h;
+}
+
+/* Return the entry for the method (or the mark if name is NULL),
+   or the unused entry where it would go */
+
+static struct methodentry *
+lookentry(list, name)
+	struct methodlist *list;
+	char *name;
+{
+	register unsigned int i = methodhash(list, name) & (indexsize-1);
+	register struct methodentry *ep;
+	for (;; i = (i+1) & (indexsize-1)) {
+		ep = &methodindex[i];
+		if (ep->me_list == NULL)
+			break;
+		if (ep->me_list != list)
+			continue;
+		if (name == NULL ? ep->me_ml == NULL :
+				ep->me_ml != NULL &&
+				strcmp(ep->me_ml->ml_name, name) == 0)
+			break;
+	}
+	return ep;
+}
+
+/* Make sure a method table is in the index.
+   Return 0 if it is, or -1 (without setting an error) if out of memory */
+
+static int
+indexlist(list)
+	struct methodlist *list;
+{
+	struct methodentry *ep, *old;
+	struct methodlist *ml;
+	unsigned int n, size, oldsize;
+	if (indexsize > 0 && lookentry(list, (char *)NULL)->me_list != NULL)
+		return 0;
+	for (n = 1, ml = list; ml->ml_name != NULL; ml++)
+		n++;
+	/* Keep the index at most half full */
+	for (size = indexsize == 0 ? 64 : indexsize;
+				2*(indexused + n) > size; size *= 2)
+		;
+	if (size != indexsize) {
+		ep = NEW(struct methodentry, size);
+		if (ep == NULL)
+			return -1;
+		old = methodindex;
+		oldsize = indexsize;
+		methodindex = ep;
+		indexsize = size;
+		for (n = 0; n < size; n++)
+			methodindex[n].me_list = NULL;
+		for (n = 0; n < oldsize; n++) {
+			if (old[n].me_list != NULL) {
+				ep = lookentry(old[n].me_list, old[n].me_ml ==
+					NULL ? (char *)NULL : old[n].me_ml->ml_name);
+				*ep = old[n];
+			}
+		}
+		XDEL(old);
+	}
+	ep = lookentry(list, (char *)NULL);
+	ep->me_list = list;
+	ep->me_ml = NULL;
+	ep->me_func = NULL;
+	indexused++;
+	for (ml = list; ml->ml_name != NULL; ml++) {
+		ep = lookentry(list, ml->ml_name);
+		if (ep->me_list == NULL) { /* The first of equal names wins */
+			ep->me_list = list;
+			ep->me_ml = ml;
+			ep->me_func = NULL;
+			indexused++;
+		}
+	}
+	return 0;
+}
+
 /* Find a method in a module's method table.
    Usually called from a module's getattr method. */
 
@@ -24,12 +140,56 @@ findmethod(ml, op, name)
 	object *op;
 	char *name;
 {
-	for (; ml->ml_name != NULL; ml++) {
-		if (strcmp(name, ml->ml_name) == 0)
-			return newmethodobject(ml->ml_name, ml->ml_meth, op);
+	struct methodentry *ep;
+	if (indexlist(ml) == 0) {
+		ep = lookentry(ml, name);
+		if (ep->me_list != NULL)
+			ml = ep->me_ml;
+		else
+			ml = NULL;
 	}
-	err_setstr(NameError, name);
-	return NULL;
+	else {
+		for (; ml->ml_name != NULL; ml++) {
+			if (strcmp(name, ml->ml_name) == 0)
+				break;
+		}
+		if (ml->ml_name == NULL)
+			ml = NULL;
+	}
+	if (ml == NULL) {
+		err_setstr(NameError, name);
+		return NULL;
+	}
+	return newflagmethodobject(ml->ml_name, ml->ml_meth, op, ml->ml_flags);
+}
+
+/* Find a method of the type of v through its tp_methods, as a method
+   object without self; the caller supplies v as self when calling it.
+   Returns a new reference, or NULL (without setting an error) if there
+   is no such method or the method object can't be made. */
+
+object *
+getmethodfunc(v, name)
+	object *v;
+	char *name;
+{
+	struct methodlist *list = v->ob_type->tp_methods;
+	struct methodentry *ep;
+	if (list == NULL || indexlist(list) != 0)
+		return NULL;
+	ep = lookentry(list, name);
+	if (ep->me_list == NULL)
+		return NULL;
+	if (ep->me_func == NULL) {
+		ep->me_func = newflagmethodobject(ep->me_ml->ml_name,
+			ep->me_ml->ml_meth, (object *)NULL, ep->me_ml->ml_flags);
+		if (ep->me_func == NULL) {
+			err_clear();
+			return NULL;
+		}
+	}
+	INCREF(ep->me_func);
+	return ep->me_func;
 }
 
 
@@ -46,7 +206,8 @@ initmodule(name, methods)
 	}
 	d = getmoduledict(m);
 	for (ml = methods; ml->ml_name != NULL; ml++) {
-		v = newmethodobject(ml->ml_name, ml->ml_meth, (object *)NULL);
+		v = newflagmethodobject(ml->ml_name, ml->ml_meth,
+						(object *)NULL, ml->ml_flags);
 		if (v == NULL || dictinsert(d, ml->ml_name, v) != 0) {
 			fprintf(stderr, "initializing module: %s\n", name);
 			fatal("can't initialize module");
@@ -58,7 +219,178 @@ initmodule(name, methods)
 }
 
 
-/* Argument list handling tools.
+/* Generic argument parser (see modsupport.h for the format letters).
+   Each argument consumes one letter, or a parenthesized group if it
+   is a tuple; *p_format is advanced past what was used. */
+
+static int getitems PROTO((object **, int, char **, va_list *));
+
+/* Convert an int or a long that fits in a C long */
+
+static int
+getlongnum(v, p)
+	object *v;
+	long *p;
+{
+	if (is_intobject(v))
+		*p = getintvalue(v);
+	else if (is_longobject(v)) {
+		*p = getlongvalue(v);
+		if (*p == -1 && err_occurred())
+			return 0;
+	}
+	else
+		return err_badarg();
+	return 1;
+}
+
+static int
+getitem(v, p_format, p_va)
+	object *v;
+	char **p_format;
+	va_list *p_va;
+{
+	switch (*(*p_format)++) {
+	
+	case 'i':
+		{
+			int *p = va_arg(*p_va, int *);
+			if (!is_intobject(v))
+				return err_badarg();
+			*p = getintvalue(v);
+			return 1;
+		}
+	
+	case 'l':
+		{
+			long *p = va_arg(*p_va, long *);
+			return getlongnum(v, p);
+		}
+	
+	case 'd':
+		{
+			double *p = va_arg(*p_va, double *);
+			if (is_floatobject(v))
+				*p = getfloatvalue(v);
+			else if (is_intobject(v))
+				*p = getintvalue(v);
+			else
+				return err_badarg();
+			return 1;
+		}
+	
+	case 's':
+		{
+			object **p = va_arg(*p_va, object **);
+			if (!is_stringobject(v))
+				return err_badarg();
+			*p = v;
+			return 1;
+		}
+	
+	case 'O':
+		{
+			object **p = va_arg(*p_va, object **);
+			*p = v;
+			return 1;
+		}
+	
+	case '(':
+		if (!is_tupleobject(v))
+			return err_badarg();
+		if (!getitems(gettupleitems(v), gettuplesize(v),
+							p_format, p_va))
+			return 0;
+		(*p_format)++; /* Skip ')' */
+		return 1;
+	
+	default:
+		err_setstr(SystemError, "bad format for getargs");
+		return 0;
+	
+	}
+}
+
+static int
+getitems(argv, argc, p_format, p_va)
+	object **argv;
+	int argc;
+	char **p_format;
+	va_list *p_va;
+{
+	int i;
+	for (i = 0; i < argc; i++) {
+		if (**p_format == '\0' || **p_format == ')')
+			return err_badarg();
+		if (!getitem(argv[i], p_format, p_va))
+			return 0;
+	}
+	if (**p_format != '\0' && **p_format != ')')
+		return err_badarg();
+	return 1;
+}
+
+#ifdef __STDC__
+int
+getargs(object **argv, int argc, char *format, ...)
+#else
+int
+getargs(va_alist)
+	va_dcl
+#endif
+{
+	va_list va;
+	int ok;
+#ifdef __STDC__
+	va_start(va, format);
+#else
+	object **argv;
+	int argc;
+	char *format;
+	va_start(va);
+	argv = va_arg(va, object **);
+	argc = va_arg(va, int);
+	format = va_arg(va, char *);
+#endif
+	ok = getitems(argv, argc, &format, &va);
+	va_end(va);
+	return ok;
+}
+
+#ifdef __STDC__
+int
+getobjargs(object *v, char *format, ...)
+#else
+int
+getobjargs(va_alist)
+	va_dcl
+#endif
+{
+	va_list va;
+	int ok;
+#ifdef __STDC__
+	va_start(va, format);
+#else
+	object *v;
+	char *format;
+	va_start(va);
+	v = va_arg(va, object *);
+	format = va_arg(va, char *);
+#endif
+	/* The arguments as an argument array method sees them (see
+	   call_args() in ceval.c): none, a tuple's items, or v itself */
+	if (v == NULL)
+		ok = getitems((object **)NULL, 0, &format, &va);
+	else if (is_tupleobject(v))
+		ok = getitems(gettupleitems(v), gettuplesize(v), &format, &va);
+	else
+		ok = getitems(&v, 1, &format, &va);
+	va_end(va);
+	return ok;
+}
+
+
+/* Argument list handling tools for particular formats.
    All return 1 for success, or call err_set*() and return 0 for failure */
 
 int
@@ -89,11 +421,7 @@ getintintarg(v, a, b)
 	int *a;
 	int *b;
 {
-	if (v == NULL || !is_tupleobject(v) || gettuplesize(v) != 2) {
-		return err_badarg();
-	}
-	return getintarg(gettupleitem(v, 0), a) &&
-		getintarg(gettupleitem(v, 1), b);
+	return getobjargs(v, "ii", a, b);
 }
 
 int
@@ -101,11 +429,10 @@ getlongarg(v, a)
 	object *v;
 	long *a;
 {
-	if (v == NULL || !is_intobject(v)) {
+	if (v == NULL) {
 		return err_badarg();
 	}
-	*a = getintvalue(v);
-	return 1;
+	return getlongnum(v, a);
 }
 
 int
@@ -113,11 +440,7 @@ getlonglongargs(v, a, b)
 	object *v;
 	long *a, *b;
 {
-	if (v == NULL || !is_tupleobject(v) || gettuplesize(v) != 2) {
-		return err_badarg();
-	}
-	return getlongarg(gettupleitem(v, 0), a) &&
-		getlongarg(gettupleitem(v, 1), b);
+	return getobjargs(v, "ll", a, b);
 }
 
 int
@@ -126,17 +449,7 @@ getlonglongobjectargs(v, a, b, c)
 	long *a, *b;
 	object **c;
 {
-	if (v == NULL || !is_tupleobject(v) || gettuplesize(v) != 3) {
-		return err_badarg();
-	}
-	if (getlongarg(gettupleitem(v, 0), a) &&
-		getlongarg(gettupleitem(v, 1), b)) {
-		*c = gettupleitem(v, 2);
-		return 1;
-	}
-	else {
-		return err_badarg();
-	}
+	return getobjargs(v, "llO", a, b, c);
 }
 
 int
@@ -157,11 +470,7 @@ getstrstrarg(v, a, b)
 	object **a;
 	object **b;
 {
-	if (v == NULL || !is_tupleobject(v) || gettuplesize(v) != 2) {
-		return err_badarg();
-	}
-	return getstrarg(gettupleitem(v, 0), a) &&
-		getstrarg(gettupleitem(v, 1), b);
+	return getobjargs(v, "ss", a, b);
 }
 
 int
@@ -171,12 +480,7 @@ getstrstrintarg(v, a, b, c)
 	object **b;
 	int *c;
 {
-	if (v == NULL || !is_tupleobject(v) || gettuplesize(v) != 3) {
-		return err_badarg();
-	}
-	return getstrarg(gettupleitem(v, 0), a) &&
-		getstrarg(gettupleitem(v, 1), b) &&
-		getintarg(gettupleitem(v, 2), c);
+	return getobjargs(v, "ssi", a, b, c);
 }
 
 int
@@ -185,11 +489,7 @@ getstrintarg(v, a, b)
 	object **a;
 	int *b;
 {
-	if (v == NULL || !is_tupleobject(v) || gettuplesize(v) != 2) {
-		return err_badarg();
-	}
-	return getstrarg(gettupleitem(v, 0), a) &&
-		getintarg(gettupleitem(v, 1), b);
+	return getobjargs(v, "si", a, b);
 }
 
 int
@@ -198,11 +498,7 @@ getintstrarg(v, a, b)
 	int *a;
 	object **b;
 {
-	if (v == NULL || !is_tupleobject(v) || gettuplesize(v) != 2) {
-		return err_badarg();
-	}
-	return getintarg(gettupleitem(v, 0), a) &&
-		getstrarg(gettupleitem(v, 1), b);
+	return getobjargs(v, "is", a, b);
 }
 
 int
@@ -210,7 +506,7 @@ getpointarg(v, a)
 	object *v;
 	int *a; /* [2] */
 {
-	return getintintarg(v, a, a+1);
+	return getobjargs(v, "ii", a, a+1);
 }
 
 int
@@ -218,12 +514,7 @@ get3pointarg(v, a)
 	object *v;
 	int *a; /* [6] */
 {
-	if (v == NULL || !is_tupleobject(v) || gettuplesize(v) != 3) {
-		return err_badarg();
-	}
-	return getpointarg(gettupleitem(v, 0), a) &&
-		getpointarg(gettupleitem(v, 1), a+2) &&
-		getpointarg(gettupleitem(v, 2), a+4);
+	return getobjargs(v, "(ii)(ii)(ii)", a, a+1, a+2, a+3, a+4, a+5);
 }
 
 int
@@ -231,11 +522,7 @@ getrectarg(v, a)
 	object *v;
 	int *a; /* [2+2] */
 {
-	if (v == NULL || !is_tupleobject(v) || gettuplesize(v) != 2) {
-		return err_badarg();
-	}
-	return getpointarg(gettupleitem(v, 0), a) &&
-		getpointarg(gettupleitem(v, 1), a+2);
+	return getobjargs(v, "(ii)(ii)", a, a+1, a+2, a+3);
 }
 
 int
@@ -243,11 +530,7 @@ getrectintarg(v, a)
 	object *v;
 	int *a; /* [4+1] */
 {
-	if (v == NULL || !is_tupleobject(v) || gettuplesize(v) != 2) {
-		return err_badarg();
-	}
-	return getrectarg(gettupleitem(v, 0), a) &&
-		getintarg(gettupleitem(v, 1), a+4);
+	return getobjargs(v, "((ii)(ii))i", a, a+1, a+2, a+3, a+4);
 }
 
 int
@@ -255,11 +538,7 @@ getpointintarg(v, a)
 	object *v;
 	int *a; /* [2+1] */
 {
-	if (v == NULL || !is_tupleobject(v) || gettuplesize(v) != 2) {
-		return err_badarg();
-	}
-	return getpointarg(gettupleitem(v, 0), a) &&
-		getintarg(gettupleitem(v, 1), a+2);
+	return getobjargs(v, "(ii)i", a, a+1, a+2);
 }
 
 int
@@ -268,25 +547,16 @@ getpointstrarg(v, a, b)
 	int *a; /* [2] */
 	object **b;
 {
-	if (v == NULL || !is_tupleobject(v) || gettuplesize(v) != 2) {
-		return err_badarg();
-	}
-	return getpointarg(gettupleitem(v, 0), a) &&
-		getstrarg(gettupleitem(v, 1), b);
+	return getobjargs(v, "(ii)s", a, a+1, b);
 }
 
 int
 getstrintintarg(v, a, b, c)
 	object *v;
-	object *a;
+	object **a;
 	int *b, *c;
 {
-	if (v == NULL || !is_tupleobject(v) || gettuplesize(v) != 3) {
-		return err_badarg();
-	}
-	return getstrarg(gettupleitem(v, 0), a) &&
-		getintarg(gettupleitem(v, 1), b) &&
-		getintarg(gettupleitem(v, 2), c);
+	return getobjargs(v, "sii", a, b, c);
 }
 
 int
@@ -294,11 +564,7 @@ getrectpointarg(v, a)
 	object *v;
 	int *a; /* [4+2] */
 {
-	if (v == NULL || !is_tupleobject(v) || gettuplesize(v) != 2) {
-		return err_badarg();
-	}
-	return getrectarg(gettupleitem(v, 0), a) &&
-		getpointarg(gettupleitem(v, 1), a+4);
+	return getobjargs(v, "((ii)(ii))(ii)", a, a+1, a+2, a+3, a+4, a+5);
 }
 
 int
@@ -30,9 +30,17 @@ extern char *getenv();
 #include "object.h"
 #include "stringobject.h"
 #include "sysmodule.h"
+#include "context.h" /* For import.h */
+#include "import.h"
 
 extern grammar gram; /* From graminit.c */
 
+/* Built-in module initializations */
+extern void inittime(), initmath(), initarray(), initmarshal();
+#ifdef USE_POSIX
+extern void initposix();
+#endif
+
 #ifndef PYTHONPATH
 
 #ifdef THINK_C
@@ -53,6 +61,8 @@ extern grammar gram; /* From graminit.c */
 
 int debugging;
 
+extern int optimizing; /* From compile.c */
+
 main(argc, argv)
 	int argc;
 	char **argv;
@@ -61,6 +71,7 @@ main(argc, argv)
 	char *filename = NULL;
 	FILE *fp = stdin;
 	int ret;
+	int stream = 0;
 	
 #ifdef USE_STDWIN
 #ifdef THINK_C
@@ -97,9 +108,26 @@ main(argc, argv)
 	
 	/* XXX what is the ideal initialization order? */
 	
+#ifndef THINK_C
+	/* Opt-in: initialize and load modules when first used */
+	if (getenv("PYTHONLAZY") != NULL)
+		setlazyimport(1);
+	/* Opt-in: parse and execute files a statement at a time */
+	if (getenv("PYTHONSTREAM") != NULL) {
+		setstreamimport(1);
+		stream = 1;
+	}
+	/* Opt-out: compile without the peephole optimizer (and so
+	   without reading or writing .pyc files) */
+	if (getenv("PYTHONNOOPT") != NULL)
+		optimizing = 0;
+#endif
+	
 	initsys(argc-1, argv+1);
-	inittime();
-	initmath();
+	initbuiltin("time", inittime);
+	initbuiltin("math", initmath);
+	initbuiltin("array", initarray);
+	initbuiltin("marshal", initmarshal);
 	
 #ifndef THINK_C
 	path = getenv("PYTHONPATH");
@@ -111,7 +139,7 @@ main(argc, argv)
 	initrun();
 	
 #ifdef USE_POSIX
-	initposix();
+	initbuiltin("posix", initposix);
 #endif
 
 #ifdef THINK_C
@@ -140,7 +168,10 @@ main(argc, argv)
 #endif
 	
 	if (!isatty(fileno(fp))) {
-		ret = runfile(fp, file_input, (char *)NULL, (char *)NULL);
+		if (stream)
+			ret = runstmts(fp);
+		else
+			ret = runfile(fp, file_input, (char *)NULL, (char *)NULL);
 	}
 	else {
 		sysset("ps1", newstringobject(">>> "));
@@ -208,7 +239,34 @@ runfile(fp, start, ps1, ps2)
 	ret = parsefile(fp, &gram, start, ps1, ps2, &n);
 	if (ret != E_DONE)
 		return ret;
-	return execute(n) == 0 ? E_DONE : E_ERROR;
+	ret = execute(n) == 0 ? E_DONE : E_ERROR;
+	freetree(n);
+	return ret;
+}
+
+/* Parse, compile and execute a file one statement at a time, so only
+   one statement's parse tree is in memory.  Statements before a
+   syntax error have already been executed. */
+
+static int
+runstmts(fp)
+	FILE *fp;
+{
+	struct stmtfile *sf;
+	node *n;
+	int ret;
+	if ((sf = openstmts(fp)) == NULL)
+		return E_NOMEM;
+	while ((ret = parsestmt(sf, &gram, stmt, &n)) == E_DONE) {
+		ret = execute(n);
+		freetree(n);
+		if (ret != 0) {
+			ret = E_ERROR;
+			break;
+		}
+	}
+	closestmts(sf);
+	return ret == E_EOF ? E_DONE : ret;
 }
 
 #ifdef THINK_C
@@ -10,6 +10,8 @@ Data members:
 - modules: the table of modules (dictionary)
 Function members:
 - exit(sts): call exit()
+- importstats(): (lookups, directory reads, failing opens avoided)
+  for the import directory cache
 */
 
 #include <stdio.h>
@@ -104,6 +106,18 @@ sys_exit(self, args)
 	/* NOTREACHED */
 }
 
+/* sys.importstats method */
+
+static object *
+sys_importstats(self, args)
+	object *self;
+	object *args;
+{
+	if (!getnoarg(args))
+		return NULL;
+	return import_stats();
+}
+
 static object *sysin, *sysout, *syserr;
 
 void
@@ -112,7 +126,7 @@ initsys(argc, argv)
 	char **argv;
 {
 	object *v;
-	object *exit;
+	object *exit, *importstats;
 	if ((sysdict = newdictobject()) == NULL)
 		fatal("can't create sys dict");
 	/* NB keep an extra ref to the std files to avoid closing them
@@ -122,6 +136,8 @@ initsys(argc, argv)
 	syserr = newopenfileobject(stderr, "<stderr>", "w");
 	v = makeargv(argc, argv);
 	exit = newmethodobject("exit", sys_exit, (object *)NULL);
+	importstats = newmethodobject("importstats", sys_importstats,
+							(object *)NULL);
 	if (err_occurred())
 		fatal("can't create sys.* objects");
 	dictinsert(sysdict, "stdin", sysin);
@@ -129,6 +145,7 @@ initsys(argc, argv)
 	dictinsert(sysdict, "stderr", syserr);
 	dictinsert(sysdict, "argv", v);
 	dictinsert(sysdict, "exit", exit);
+	dictinsert(sysdict, "importstats", importstats);
 	if (err_occurred())
 		fatal("can't insert sys.* objects in sys dict");
 	DECREF(v);